@@ -0,0 +1,200 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include "DoubleDouble.hpp"
+#include "PricingKernel.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @file AccuracyHarness.hpp
+ * @brief Accuracy regression checks of the pricing backends against an extended-precision reference
+ *
+ * Every backend is run over a dense grid of random contracts plus edge cases
+ * (deep ITM/OTM, tiny T, huge σ) and each OptionPrices field is compared with
+ * a double-double reference from HighPrecision::price_extended. A value passes
+ * when it is within the backend's declared absolute or relative tolerance;
+ * any failing value fails the backend, so faster or approximate kernels can
+ * be gated on the same report before they are switched on.
+ */
+
+namespace BlackScholes::Accuracy {
+
+/**
+ * @brief Reference result in double-double, indexed by OptionField
+ */
+using ReferencePrices = std::array<HighPrecision::DoubleDouble, option_field_count>;
+
+/**
+ * @brief Prices and Greeks of one contract from the double-double backend
+ *
+ * About 32 significant digits on every platform, including deep out-of-the-
+ * money tails, so the reference error is negligible next to any double path.
+ * The precision_check test pins this code to quad-precision values, which
+ * the audit cannot do for its own reference.
+ *
+ * @tparam Variant BlackScholesMerton, Black76 or GarmanKohlhagen
+ */
+template <class Variant>
+[[nodiscard]] ReferencePrices reference_prices(double S, double K, double T,
+                                               double r, double q, double sigma) noexcept;
+
+/**
+ * @brief Error bound declared by a backend
+ *
+ * A value passes when |x - ref| ≤ absolute or |x - ref| ≤ relative·|ref|.
+ * The absolute bound covers results that cancel or underflow towards zero,
+ * the relative bound covers large Greeks such as short-dated gamma and theta.
+ */
+struct Tolerance {
+    double absolute = 1e-9;  ///< Allowed absolute error
+    double relative = 1e-9;  ///< Allowed error relative to the reference
+};
+
+/**
+ * @brief A pricing path under test
+ */
+struct Backend {
+    /**
+     * @brief Price a whole grid into one OptionPrices per contract
+     */
+    using Evaluate = std::function<void(const OptionBatch&, std::span<OptionPrices>)>;
+
+    /**
+     * @brief Reference matching the backend's carry model
+     */
+    using Reference = ReferencePrices (*)(double, double, double, double, double, double) noexcept;
+
+    std::string name;                               ///< Label in the report
+    Evaluate evaluate;                              ///< Backend under test
+    Reference reference;                            ///< Reference it is compared with
+    std::array<bool, option_field_count> fields{};  ///< Fields the backend produces
+    Tolerance tolerance;                            ///< Declared error bound
+};
+
+/**
+ * @brief Fields set by backends that return prices only
+ */
+inline constexpr std::array<bool, option_field_count> price_fields{true, true};
+
+/**
+ * @brief Fields set by backends that return full Greeks
+ */
+inline constexpr std::array<bool, option_field_count> all_fields{true, true, true, true, true,
+                                                                 true, true, true, true, true};
+
+/**
+ * @brief Owning structure-of-arrays grid of test contracts
+ */
+struct Grid {
+    std::vector<double> underlying_price;
+    std::vector<double> strike_price;
+    std::vector<double> time_to_expiration;
+    std::vector<double> risk_free_rate;
+    std::vector<double> dividend_yield;
+    std::vector<double> volatility;
+
+    /**
+     * @brief Number of contracts
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return underlying_price.size(); }
+
+    /**
+     * @brief Append one contract
+     */
+    void add(double S, double K, double T, double r, double q, double sigma);
+
+    /**
+     * @brief Batch view over the columns for the kernels
+     */
+    [[nodiscard]] OptionBatch batch() const noexcept;
+};
+
+/**
+ * @brief Build the standard audit grid
+ *
+ * Random contracts drawn log-uniformly over moneyness 0.2-5, T from one day
+ * to 10 years and σ from 2% to 200%, followed by a full cross of edge cases:
+ * strikes from 10⁻⁴ to 100× spot, T down to 10⁻⁶ years and σ up to 1000%.
+ * Spot is fixed at 100 since prices scale linearly with S and K, so absolute
+ * tolerances read as errors per 100 of notional.
+ *
+ * @param random_points Number of random contracts
+ * @param seed Seed for the random contracts, so runs are reproducible
+ */
+[[nodiscard]] Grid make_grid(std::size_t random_points = 20000, std::uint64_t seed = 20240601);
+
+/**
+ * @brief Error statistics of one field of one backend
+ */
+struct FieldError {
+    double max_abs_error = 0.0;   ///< Largest absolute error
+    double mean_abs_error = 0.0;  ///< Mean absolute error
+    double max_rel_error = 0.0;   ///< Largest error relative to a non-zero reference
+    double mean_rel_error = 0.0;  ///< Mean relative error over non-zero references
+    std::size_t failures = 0;     ///< Values outside the tolerance
+    std::size_t worst_row = 0;    ///< Grid row furthest outside (or closest to) the tolerance
+};
+
+/**
+ * @brief Audit result of one backend
+ */
+struct BackendReport {
+    std::string name;
+    std::array<bool, option_field_count> fields{};
+    Tolerance tolerance;
+    std::array<FieldError, option_field_count> errors{};
+
+    /**
+     * @brief Total failing values over all fields
+     */
+    [[nodiscard]] std::size_t failures() const noexcept;
+
+    /**
+     * @brief true when every value is within tolerance
+     */
+    [[nodiscard]] bool passed() const noexcept { return failures() == 0; }
+};
+
+/**
+ * @brief Audit result of a set of backends over one grid
+ */
+struct Report {
+    std::size_t rows = 0;
+    std::vector<BackendReport> backends;
+
+    /**
+     * @brief true when every backend passed
+     */
+    [[nodiscard]] bool passed() const noexcept;
+};
+
+/**
+ * @brief Every built-in pricing path with its declared tolerance
+ *
+ * Kernel::price_batch for the three carry models, Kernel::value_batch,
+ * Model::calculate_prices, Model::call_price/put_price, the spot-tick path
+ * of IncrementalEngine, Constexpr::value and the double-double batch. The
+ * double-double batch shares its arithmetic with the reference, so its row
+ * checks only the batch path and the final rounding to double.
+ */
+[[nodiscard]] std::vector<Backend> default_backends();
+
+/**
+ * @brief Evaluate backends over a grid and compare them with their references
+ * @throws std::invalid_argument if a backend has no evaluate or reference function
+ */
+[[nodiscard]] Report run(const Grid& grid, const std::vector<Backend>& backends);
+
+/**
+ * @brief Print a per-backend, per-field error table and the inputs of each failing field's worst row
+ */
+void write_report(std::ostream& out, const Report& report, const Grid& grid);
+
+} // namespace BlackScholes::Accuracy
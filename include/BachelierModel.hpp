@@ -0,0 +1,147 @@
+#pragma once
+
+#include "PricingKernel.hpp"
+#include <cmath>
+#include <span>
+
+/**
+ * @file BachelierModel.hpp
+ * @brief Bachelier (normal) model for forwards that may be zero or negative
+ *
+ * The forward follows dF = σ_N·dW with an absolute volatility σ_N, so spread
+ * options and negative-rate products price without a positivity constraint.
+ * The inline kernel mirrors PricingKernel.hpp. The batch and implied
+ * volatility loops call it row by row; like the lognormal batches they are
+ * scalar, with no SIMD path.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Inputs for a normal-model option on a forward
+ */
+struct NormalOptionParameters {
+    double forward;             ///< Forward or spread level F (any sign)
+    double strike_price;        ///< Strike K (any sign)
+    double time_to_expiration;  ///< Time to expiration T in years (> 0)
+    double risk_free_rate;      ///< Discount rate r
+    double volatility;          ///< Absolute normal volatility σ_N (> 0)
+
+    /**
+     * @brief Validate all parameters
+     * @return true if all parameters are valid
+     */
+    [[nodiscard]] bool is_valid() const noexcept;
+};
+
+namespace Bachelier {
+
+/**
+ * @brief Prices and Greeks of a single contract
+ *
+ * Delta and gamma are with respect to the forward; vega is per 0.01 change
+ * in σ_N and rho reflects discounting only, as for Black-76.
+ */
+[[nodiscard]] inline OptionPrices price(double F, double K, double T, double r, double sigma) noexcept {
+    const double sqrt_T = std::sqrt(T);
+    const double sigma_sqrt_T = sigma * sqrt_T;
+    const double moneyness = F - K;
+    const double d = moneyness / sigma_sqrt_T;
+
+    const auto [N_d, N_neg_d, phi_d] = Kernel::normal_tails(d);
+    const double discount_factor = std::exp(-r * T);
+
+    const double call = discount_factor * (moneyness * N_d + sigma_sqrt_T * phi_d);
+    const double put = discount_factor * (-moneyness * N_neg_d + sigma_sqrt_T * phi_d);
+    const double time_decay = -discount_factor * sigma * phi_d / (2.0 * sqrt_T);
+
+    return OptionPrices{
+        .call_price = call,
+        .put_price = put,
+        .delta_call = discount_factor * N_d,
+        .delta_put = -discount_factor * N_neg_d,
+        .gamma = discount_factor * phi_d / sigma_sqrt_T,
+        .theta_call = (time_decay + r * call) / 365.25,  // Convert to per day
+        .theta_put = (time_decay + r * put) / 365.25,    // Convert to per day
+        .vega = discount_factor * sqrt_T * phi_d / 100.0, // Convert to per 0.01 volatility change
+        .rho_call = -T * call / 100.0,                   // Convert to per 1% rate change
+        .rho_put = -T * put / 100.0                      // Convert to per 1% rate change
+    };
+}
+
+/**
+ * @brief Call and put prices of a single contract
+ */
+[[nodiscard]] inline Kernel::OptionValues value(double F, double K, double T, double r, double sigma) noexcept {
+    const double sigma_sqrt_T = sigma * std::sqrt(T);
+    const double moneyness = F - K;
+    const double d = moneyness / sigma_sqrt_T;
+    const double discount_factor = std::exp(-r * T);
+    const auto [N_d, N_neg_d, phi_d] = Kernel::normal_tails(d);
+    const double time_value = sigma_sqrt_T * phi_d;
+
+    return Kernel::OptionValues{
+        .call_price = discount_factor * (moneyness * N_d + time_value),
+        .put_price = discount_factor * (-moneyness * N_neg_d + time_value)
+    };
+}
+
+/**
+ * @brief Price a single contract with validation
+ * @param params Normal-model inputs
+ * @return Prices and Greeks
+ * @throws std::invalid_argument if parameters are invalid
+ */
+[[nodiscard]] OptionPrices calculate_prices(const NormalOptionParameters& params);
+
+/**
+ * @brief Price a batch with full Greeks
+ *
+ * underlying_price holds the forwards and volatility the normal
+ * volatilities; dividend_yield is ignored.
+ *
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+void price_batch(const OptionBatch& batch, std::span<OptionPrices> out);
+
+/**
+ * @brief Price a batch into separate call and put columns
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+void value_batch(const OptionBatch& batch, std::span<double> calls, std::span<double> puts);
+
+/**
+ * @brief Normal implied volatility from a discounted option price
+ *
+ * Jäckel's (2017) rational approximation followed by one Householder step,
+ * accurate to near machine precision without iteration.
+ *
+ * @param price Discounted option price
+ * @param type Call or put
+ * @return σ_N, 0 for a price at intrinsic value, NaN below intrinsic value
+ */
+[[nodiscard]] double implied_volatility(double price, double F, double K, double T, double r,
+                                        OptionType type) noexcept;
+
+/**
+ * @brief Normal implied volatilities for a batch of quotes
+ * @param type Call or put, shared by the batch
+ * @param prices Discounted option prices
+ * @param forwards Forwards F
+ * @param strikes Strikes K
+ * @param expiries Times to expiration T
+ * @param rates Discount rates r
+ * @param volatilities Destination σ_N (NaN for prices below intrinsic value)
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+void implied_volatility_batch(OptionType type,
+                              std::span<const double> prices,
+                              std::span<const double> forwards,
+                              std::span<const double> strikes,
+                              std::span<const double> expiries,
+                              std::span<const double> rates,
+                              std::span<double> volatilities);
+
+} // namespace Bachelier
+
+} // namespace BlackScholes
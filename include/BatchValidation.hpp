@@ -0,0 +1,111 @@
+#pragma once
+
+#include "PricingKernel.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file BatchValidation.hpp
+ * @brief Exception-free bulk validation of option batches
+ *
+ * Rows are checked with branch-free comparisons into a per-row reason code
+ * and a packed bitmask of valid rows. Feeds with bad rows are screened once,
+ * after which the batch kernels and the Model::*_trusted entry points price
+ * without re-validating or throwing.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Reasons a row can fail validation, combined as bit flags
+ */
+enum class ValidationReason : std::uint8_t {
+    None = 0,                          ///< Row is valid
+    NonPositiveUnderlying = 1u << 0,   ///< S ≤ 0 or NaN
+    NonPositiveStrike = 1u << 1,       ///< K ≤ 0 or NaN
+    NonPositiveExpiry = 1u << 2,       ///< T ≤ 0 or NaN
+    NonPositiveVolatility = 1u << 3,   ///< σ ≤ 0 or NaN
+    NonFiniteRate = 1u << 4,           ///< r is infinite or NaN
+    NonFiniteYield = 1u << 5,          ///< q is infinite or NaN
+    NonFiniteInput = 1u << 6           ///< S, K, T or σ is infinite or NaN
+};
+
+/**
+ * @brief Check whether a row's reason code contains a given reason
+ */
+[[nodiscard]] constexpr bool has_reason(std::uint8_t code, ValidationReason reason) noexcept {
+    return (code & static_cast<std::uint8_t>(reason)) != 0;
+}
+
+/**
+ * @brief Human-readable description of a single reason
+ */
+[[nodiscard]] std::string_view describe(ValidationReason reason) noexcept;
+
+/**
+ * @brief Outcome of validating a batch
+ */
+struct ValidationReport {
+    std::pmr::vector<std::uint64_t> valid_mask;  ///< Bit i of word i/64 set when row i is valid
+    std::pmr::vector<std::uint8_t> reasons;      ///< Per-row ValidationReason flags (0 = valid)
+    std::size_t valid_count = 0;                 ///< Number of valid rows
+
+    /**
+     * @brief Check whether a row passed validation
+     */
+    [[nodiscard]] bool is_valid(std::size_t row) const noexcept {
+        return (valid_mask[row / 64] >> (row % 64)) & 1u;
+    }
+
+    /**
+     * @brief Check whether every row passed validation
+     */
+    [[nodiscard]] bool all_valid() const noexcept { return valid_count == reasons.size(); }
+};
+
+/**
+ * @brief Number of 64-bit mask words needed for a batch
+ */
+[[nodiscard]] constexpr std::size_t mask_words(std::size_t rows) noexcept {
+    return (rows + 63) / 64;
+}
+
+/**
+ * @brief Validate a batch into caller-provided buffers without allocating
+ * @param batch Structure-of-arrays inputs
+ * @param valid_mask Destination bitmask, at least mask_words(batch.size()) words
+ * @param reasons Destination reason codes, one per row
+ * @return Number of valid rows
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+std::size_t validate_batch(const OptionBatch& batch,
+                           std::span<std::uint64_t> valid_mask,
+                           std::span<std::uint8_t> reasons);
+
+/**
+ * @brief Validate a batch into a freshly allocated report
+ * @param batch Structure-of-arrays inputs
+ * @param resource Memory resource for the report's columns
+ * @return Bitmask, reason codes and valid count
+ * @throws std::invalid_argument if the batch columns have mismatched lengths
+ */
+[[nodiscard]] ValidationReport validate_batch(const OptionBatch& batch,
+                                              std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/**
+ * @brief Overwrite the values of invalid rows with NaN
+ *
+ * Lets a whole batch be priced branch-free by the kernels, then have rejected
+ * rows blanked in one pass.
+ *
+ * @param valid_mask Bitmask from validate_batch
+ * @param values Per-row results to mask
+ * @throws std::invalid_argument if the mask is too short for the values
+ */
+void mask_invalid(std::span<const std::uint64_t> valid_mask, std::span<double> values);
+
+} // namespace BlackScholes
@@ -1,8 +1,13 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <tuple>
 
 /**
  * @file BlackScholesModel.hpp
@@ -14,6 +19,22 @@
 
 namespace BlackScholes {
 
+/**
+ * @brief Option right
+ */
+enum class OptionType {
+    Call,  ///< Right to buy the underlying
+    Put    ///< Right to sell the underlying
+};
+
+/**
+ * @brief Arithmetic used by the pricing entry points that offer a choice
+ */
+enum class Precision {
+    Double,       ///< Inline double kernel (PricingKernel.hpp), the default
+    DoubleDouble  ///< Double-double backend (DoubleDouble.hpp): tail-accurate, about 50× slower
+};
+
 /**
  * @brief Strongly typed parameters for Black-Scholes model
  * 
@@ -26,6 +47,7 @@ struct OptionParameters {
     double time_to_expiration; ///< Time to expiration in years (T)
     double risk_free_rate;     ///< Risk-free interest rate (r)
     double volatility;         ///< Volatility of the underlying asset (σ)
+    double dividend_yield;     ///< Continuous dividend yield (q); foreign rate for FX options
     
     /**
      * @brief Construct option parameters with validation
@@ -34,15 +56,29 @@ struct OptionParameters {
      * @param T Time to expiration in years (must be > 0)
      * @param r Risk-free rate (can be negative in current markets)
      * @param sigma Volatility (must be > 0)
+     * @param q Continuous dividend yield (can be negative)
      * @throws std::invalid_argument if parameters are invalid
      */
-    OptionParameters(double S, double K, double T, double r, double sigma);
+    OptionParameters(double S, double K, double T, double r, double sigma, double q = 0.0);
+    
+    /**
+     * @brief Construct option parameters without validation
+     *
+     * For rows that were already checked in bulk (see BatchValidation.hpp);
+     * the caller guarantees is_valid().
+     */
+    [[nodiscard]] static OptionParameters trusted(double S, double K, double T, double r,
+                                                  double sigma, double q = 0.0) noexcept;
     
     /**
      * @brief Validate all parameters
      * @return true if all parameters are valid
      */
     [[nodiscard]] bool is_valid() const noexcept;
+
+private:
+    struct Unchecked {};
+    OptionParameters(Unchecked, double S, double K, double T, double r, double sigma, double q) noexcept;
 };
 
 /**
@@ -63,10 +99,46 @@ struct OptionPrices {
     double rho_put;     ///< Rho for put option
 };
 
+/**
+ * @brief Output fields of OptionPrices, in declaration order
+ */
+enum class OptionField : std::uint8_t {
+    CallPrice,
+    PutPrice,
+    DeltaCall,
+    DeltaPut,
+    Gamma,
+    ThetaCall,
+    ThetaPut,
+    Vega,
+    RhoCall,
+    RhoPut,
+    Count  ///< Number of fields
+};
+
+inline constexpr std::size_t option_field_count = static_cast<std::size_t>(OptionField::Count);
+
+/**
+ * @brief OptionPrices member name of a field, e.g. "delta_call"
+ */
+[[nodiscard]] std::string_view option_field_name(OptionField field) noexcept;
+
+/**
+ * @brief Display label of a field, e.g. "Delta (call)"
+ */
+[[nodiscard]] const char* option_field_label(OptionField field) noexcept;
+
+/**
+ * @brief Read one field of a result
+ */
+[[nodiscard]] double option_field_value(const OptionPrices& prices, OptionField field) noexcept;
+
 /**
  * @brief Black-Scholes option pricing model
  * 
- * Thread-safe implementation of the Black-Scholes model with full Greeks calculation
+ * Thread-safe implementation of the Black-Scholes-Merton model with full Greeks
+ * calculation. Prices honour the continuous dividend yield of the parameters;
+ * see PricingKernel.hpp for the Black-76 and Garman-Kohlhagen variants.
  */
 class Model {
 public:
@@ -78,6 +150,15 @@ public:
      */
     [[nodiscard]] static OptionPrices calculate_prices(const OptionParameters& params);
     
+    /**
+     * @brief Calculate option prices in a chosen arithmetic
+     * @param params Validated option parameters
+     * @param precision Precision::DoubleDouble for deep out-of-the-money or reference values
+     * @return Complete option pricing results including Greeks
+     * @throws std::invalid_argument if parameters are invalid
+     */
+    [[nodiscard]] static OptionPrices calculate_prices(const OptionParameters& params, Precision precision);
+    
     /**
      * @brief Calculate call option price only
      * @param params Validated option parameters
@@ -92,6 +173,27 @@ public:
      */
     [[nodiscard]] static double put_price(const OptionParameters& params);
     
+    /**
+     * @brief Calculate option prices without re-validating the parameters
+     * @param params Parameters known to satisfy is_valid()
+     * @return Complete option pricing results including Greeks
+     */
+    [[nodiscard]] static OptionPrices calculate_prices_trusted(const OptionParameters& params) noexcept;
+    
+    /**
+     * @brief Calculate call option price without re-validating the parameters
+     * @param params Parameters known to satisfy is_valid()
+     * @return Call option price
+     */
+    [[nodiscard]] static double call_price_trusted(const OptionParameters& params) noexcept;
+    
+    /**
+     * @brief Calculate put option price without re-validating the parameters
+     * @param params Parameters known to satisfy is_valid()
+     * @return Put option price
+     */
+    [[nodiscard]] static double put_price_trusted(const OptionParameters& params) noexcept;
+    
     /**
      * @brief Generate price curve for plotting
      * @param base_params Base parameters (strike, time, rate, volatility)
@@ -104,17 +206,49 @@ public:
                         double price_range = 50.0, 
                         int num_points = 100);
 
+    /**
+     * @brief Generate price curve for plotting into memory from a given resource
+     *
+     * Same points as the std::vector overload; pass a ScratchArena to keep
+     * per-request curve generation off the global heap.
+     *
+     * @param base_params Base parameters (strike, time, rate, volatility)
+     * @param price_range Range around current price to calculate
+     * @param num_points Number of points to calculate
+     * @param resource Memory resource for the returned vector
+     * @return Vector of (underlying_price, call_price, put_price) tuples
+     */
+    [[nodiscard]] static std::pmr::vector<std::tuple<double, double, double>>
+    generate_price_curve(const OptionParameters& base_params,
+                        double price_range,
+                        int num_points,
+                        std::pmr::memory_resource* resource);
+
+    /**
+     * @brief Standard normal cumulative distribution function
+     * @param x Input value
+     * @return N(x) - cumulative probability
+     */
+    [[nodiscard]] static double normal_cdf(double x) noexcept;
+    
+    /**
+     * @brief Standard normal probability density function
+     * @param x Input value
+     * @return φ(x) - probability density
+     */
+    [[nodiscard]] static double normal_pdf(double x) noexcept;
+
 private:
     /**
      * @brief Calculate d1 parameter for Black-Scholes formula
      * @param S Underlying price
      * @param K Strike price
      * @param T Time to expiration
-     * @param r Risk-free rate
+     * @param b Cost of carry (r - q)
      * @param sigma Volatility
      * @return d1 value
      */
-    [[nodiscard]] static double calculate_d1(double S, double K, double T, double r, double sigma) noexcept;
+    [[nodiscard]] static double calculate_d1(double S, double K, double T, double b, double sigma) noexcept;
     
     /**
      * @brief Calculate d2 parameter for Black-Scholes formula
@@ -126,18 +260,14 @@ private:
     [[nodiscard]] static double calculate_d2(double d1, double sigma, double T) noexcept;
     
     /**
-     * @brief Standard normal cumulative distribution function
-     * @param x Input value
-     * @return N(x) - cumulative probability
+     * @brief Fill a curve container for either generate_price_curve overload
+     * @throws std::invalid_argument if the inputs are invalid
      */
-    [[nodiscard]] static double normal_cdf(double x) noexcept;
-    
-    /**
-     * @brief Standard normal probability density function
-     * @param x Input value
-     * @return φ(x) - probability density
-     */
-    [[nodiscard]] static double normal_pdf(double x) noexcept;
+    template <class Curve>
+    static void fill_price_curve(Curve& curve,
+                                 const OptionParameters& base_params,
+                                 double price_range,
+                                 int num_points);
 };
 
 } // namespace BlackScholes
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include "HestonModel.hpp"
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file CarrMadanFft.hpp
+ * @brief Carr-Madan FFT pricer producing a whole strike grid per transform
+ *
+ * The pricer is generic over the characteristic function of the log return,
+ * so any model with a closed-form characteristic function (Black-Scholes,
+ * Heston, Variance Gamma, ...) prices a full log-strike grid with one FFT.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Callable returning E[exp(i·u·ln(S_T/S_0))] for complex u
+ */
+template <class F>
+concept CharacteristicFunction = std::regular_invocable<const F&, std::complex<double>>
+    && std::convertible_to<std::invoke_result_t<const F&, std::complex<double>>, std::complex<double>>;
+
+/**
+ * @brief Black-Scholes characteristic function of ln(S_T/S_0)
+ */
+struct BlackScholesCharacteristic {
+    double volatility;  ///< Lognormal volatility σ
+    double time;        ///< Time to expiration T
+    double carry;       ///< Cost of carry b = r - q
+
+    [[nodiscard]] std::complex<double> operator()(std::complex<double> u) const noexcept {
+        const std::complex<double> i(0.0, 1.0);
+        const double variance = volatility * volatility * time;
+        return std::exp(i * u * ((carry - 0.5 * volatility * volatility) * time) - 0.5 * variance * u * u);
+    }
+};
+
+/**
+ * @brief Heston characteristic function of ln(S_T/S_0)
+ */
+struct HestonCharacteristic {
+    HestonCosPricer model;  ///< Model providing the characteristic function
+    double time;            ///< Time to expiration T
+    double carry;           ///< Cost of carry b = r - q
+
+    [[nodiscard]] std::complex<double> operator()(std::complex<double> u) const noexcept {
+        return model.characteristic_function(u, time, carry);
+    }
+};
+
+/**
+ * @brief Variance Gamma model parameters (Madan-Carr-Chang)
+ */
+struct VarianceGammaParameters {
+    double sigma;  ///< Volatility of the subordinated Brownian motion (> 0)
+    double nu;     ///< Variance rate of the gamma time change (> 0)
+    double theta;  ///< Drift of the subordinated Brownian motion
+
+    /**
+     * @brief Validate parameters, including existence of E[S_T]
+     * @return true if all parameters are valid
+     */
+    [[nodiscard]] bool is_valid() const noexcept {
+        return sigma > 0.0 && nu > 0.0 && std::isfinite(sigma) && std::isfinite(nu) && std::isfinite(theta)
+            && 1.0 - theta * nu - 0.5 * sigma * sigma * nu > 0.0;
+    }
+};
+
+/**
+ * @brief Variance Gamma characteristic function of ln(S_T/S_0)
+ */
+struct VarianceGammaCharacteristic {
+    VarianceGammaParameters params;  ///< Model parameters
+    double time;                     ///< Time to expiration T
+    double carry;                    ///< Cost of carry b = r - q
+
+    [[nodiscard]] std::complex<double> operator()(std::complex<double> u) const noexcept {
+        const std::complex<double> i(0.0, 1.0);
+        const double s2 = params.sigma * params.sigma;
+        // Martingale correction ω so that E[S_T] = S_0·e^(bT)
+        const double omega = std::log(1.0 - params.theta * params.nu - 0.5 * s2 * params.nu) / params.nu;
+        const std::complex<double> base = 1.0 - i * params.theta * params.nu * u + 0.5 * s2 * params.nu * u * u;
+        return std::exp(i * u * ((carry + omega) * time) - (time / params.nu) * std::log(base));
+    }
+};
+
+/**
+ * @brief Discretization of the Carr-Madan integral
+ *
+ * The log-strike spacing is λ = 2π/(N·η), so the grid spans N·λ around ln S.
+ */
+struct FftGrid {
+    std::size_t size = 4096;  ///< Number of FFT points N (power of two)
+    double eta = 0.25;        ///< Spacing η of the integration variable
+    double alpha = 1.5;       ///< Damping exponent α of the call price (> 0)
+
+    /**
+     * @brief Validate the grid settings
+     * @return true if the grid can be used
+     */
+    [[nodiscard]] bool is_valid() const noexcept;
+};
+
+/**
+ * @brief Carr-Madan FFT pricer for European options
+ *
+ * Prices use S, T, r and the dividend yield from OptionParameters; strike and
+ * volatility are ignored. The characteristic function must belong to the same
+ * expiry and cost of carry. Each pricer keeps reusable work buffers, sized
+ * once from the given memory resource, so use one instance per thread.
+ */
+class CarrMadanPricer {
+public:
+    /**
+     * @brief Create a pricer
+     * @param grid Discretization settings
+     * @param resource Memory resource for the transform and native-grid buffers
+     * @throws std::invalid_argument if the grid is invalid
+     */
+    explicit CarrMadanPricer(const FftGrid& grid = {},
+                             std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Price calls on the native log-strike grid with one transform
+     * @param phi Characteristic function of ln(S_T/S_0)
+     * @param base Parameters providing S, T, r and q
+     * @param strikes Destination strikes K_u = S·e^(λ(u - N/2)), size N
+     * @param calls Destination call prices, size N
+     * @throws std::invalid_argument if inputs are invalid or spans are not size N
+     */
+    template <CharacteristicFunction F>
+    void price_grid(const F& phi, const OptionParameters& base,
+                    std::span<double> strikes, std::span<double> calls);
+
+    /**
+     * @brief Price arbitrary strikes from one transform
+     *
+     * Calls are interpolated from the native grid with local cubics in log
+     * strike; puts follow from put-call parity.
+     *
+     * @param phi Characteristic function of ln(S_T/S_0)
+     * @param base Parameters providing S, T, r and q
+     * @param strikes Strikes to price (each > 0 and inside the grid)
+     * @param calls Destination call prices
+     * @param puts Destination put prices
+     * @throws std::invalid_argument if inputs are invalid or spans mismatch
+     * @throws std::out_of_range if a strike lies outside the grid
+     */
+    template <CharacteristicFunction F>
+    void price_strikes(const F& phi, const OptionParameters& base,
+                       std::span<const double> strikes,
+                       std::span<double> calls, std::span<double> puts);
+
+    /**
+     * @brief Discretization settings
+     */
+    [[nodiscard]] const FftGrid& grid() const noexcept { return grid_; }
+
+    /**
+     * @brief Log-strike spacing λ of the native grid
+     */
+    [[nodiscard]] double log_strike_spacing() const noexcept;
+
+private:
+    template <CharacteristicFunction F>
+    void fill_integrand(const F& phi, const OptionParameters& base);
+
+    void transform(const OptionParameters& base, std::span<double> strikes, std::span<double> calls);
+
+    void interpolate(const OptionParameters& base, std::span<const double> strikes,
+                     std::span<double> calls, std::span<double> puts);
+
+    static void validate(const OptionParameters& base);
+
+    FftGrid grid_;
+    std::pmr::vector<std::complex<double>> work_;
+    std::pmr::vector<double> grid_strikes_;
+    std::pmr::vector<double> grid_calls_;
+};
+
+template <CharacteristicFunction F>
+void CarrMadanPricer::fill_integrand(const F& phi, const OptionParameters& base) {
+    validate(base);
+
+    const std::size_t N = grid_.size;
+    const double eta = grid_.eta;
+    const double alpha = grid_.alpha;
+    const double half_width = 0.5 * static_cast<double>(N) * log_strike_spacing();
+    const double discount_factor = std::exp(-base.risk_free_rate * base.time_to_expiration);
+    const std::complex<double> damping_shift(0.0, alpha + 1.0);
+
+    // x_j = e^{i·v_j·b}·ψ(v_j)·w_j with Simpson weights w_j; the grid is centred on ln S
+    for (std::size_t j = 0; j < N; ++j) {
+        const double v = eta * static_cast<double>(j);
+        const double simpson = (j == 0) ? 1.0 : (j % 2 == 1 ? 4.0 : 2.0);
+        const std::complex<double> denominator(alpha * alpha + alpha - v * v, (2.0 * alpha + 1.0) * v);
+        const std::complex<double> psi = discount_factor * phi(v - damping_shift) / denominator;
+        work_[j] = psi * std::polar(simpson * eta / 3.0, v * half_width);
+    }
+}
+
+template <CharacteristicFunction F>
+void CarrMadanPricer::price_grid(const F& phi, const OptionParameters& base,
+                                 std::span<double> strikes, std::span<double> calls) {
+    fill_integrand(phi, base);
+    transform(base, strikes, calls);
+}
+
+template <CharacteristicFunction F>
+void CarrMadanPricer::price_strikes(const F& phi, const OptionParameters& base,
+                                    std::span<const double> strikes,
+                                    std::span<double> calls, std::span<double> puts) {
+    fill_integrand(phi, base);
+    transform(base, grid_strikes_, grid_calls_);
+    interpolate(base, strikes, calls, puts);
+}
+
+} // namespace BlackScholes
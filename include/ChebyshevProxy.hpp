@@ -0,0 +1,144 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @file ChebyshevProxy.hpp
+ * @brief Tensor-product Chebyshev surrogate for repeated pricer queries
+ *
+ * Builds a Chebyshev interpolant of any pricer over a bounded box of
+ * (moneyness S/K, time to expiration T, volatility σ). Once built, evaluation
+ * is a fixed number of multiply-adds independent of the cost of the original
+ * pricer, and the coefficients can be saved to disk and reloaded at startup.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Bounded parameter box covered by the surrogate
+ */
+struct ChebyshevBox {
+    double moneyness_min;   ///< Lower bound of S/K
+    double moneyness_max;   ///< Upper bound of S/K
+    double time_min;        ///< Lower bound of T (years)
+    double time_max;        ///< Upper bound of T (years)
+    double volatility_min;  ///< Lower bound of σ
+    double volatility_max;  ///< Upper bound of σ
+
+    /**
+     * @brief Validate the box bounds
+     * @return true if every interval is finite and non-empty
+     */
+    [[nodiscard]] bool is_valid() const noexcept;
+};
+
+/**
+ * @brief Tensor-product Chebyshev interpolant over (S/K, T, σ)
+ *
+ * Evaluation uses nested Clenshaw recurrences and costs roughly
+ * 3·n_m·n_T·n_σ floating point operations; the default 6×6×6 degree is a
+ * few hundred FLOPs. max_error() is the largest error measured against the
+ * pricer at build time on the grid of Chebyshev extrema, which lies between
+ * the nodes and includes the corners of the box, where interpolation error
+ * peaks. It is a measurement, not a proven bound.
+ */
+class ChebyshevProxy {
+public:
+    /// Function approximated by the proxy: f(S/K, T, σ)
+    using Pricer = std::function<double(double moneyness, double time, double volatility)>;
+
+    /// Maximum number of nodes per dimension
+    static constexpr int max_nodes = 32;
+
+    /**
+     * @brief Build a proxy by sampling the pricer at Chebyshev nodes
+     *
+     * After the fit the pricer is called again on the (n_m+1)·(n_T+1)·(n_σ+1)
+     * grid of Chebyshev extrema to measure max_error().
+     *
+     * @param pricer Function to approximate, e.g. the call price divided by K
+     * @param box Parameter box to cover
+     * @param nodes Number of Chebyshev nodes per dimension (moneyness, T, σ)
+     * @return Fitted proxy
+     * @throws std::invalid_argument if the box or node counts are invalid
+     */
+    [[nodiscard]] static ChebyshevProxy build(const Pricer& pricer,
+                                              const ChebyshevBox& box,
+                                              std::array<int, 3> nodes = {6, 6, 6});
+
+    /**
+     * @brief Load previously saved coefficients
+     * @param path File written by save()
+     * @return Proxy identical to the one that was saved
+     * @throws std::runtime_error if the file cannot be read or is malformed
+     */
+    [[nodiscard]] static ChebyshevProxy load(const std::string& path);
+
+    /**
+     * @brief Write the coefficients to a binary file
+     * @param path Destination file
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief Evaluate the surrogate
+     * @param moneyness S/K
+     * @param time Time to expiration T
+     * @param volatility Volatility σ
+     * @return Approximated pricer value
+     * @throws std::out_of_range if the point lies outside the box
+     */
+    [[nodiscard]] double evaluate(double moneyness, double time, double volatility) const;
+
+    /**
+     * @brief Check whether a point lies inside the box
+     */
+    [[nodiscard]] bool contains(double moneyness, double time, double volatility) const noexcept;
+
+    /**
+     * @brief Largest absolute error against the pricer measured at build time
+     *
+     * Saved and loaded with the coefficients.
+     */
+    [[nodiscard]] double max_error() const noexcept { return max_error_; }
+
+    /**
+     * @brief Parameter box covered by the proxy
+     */
+    [[nodiscard]] const ChebyshevBox& box() const noexcept { return box_; }
+
+    /**
+     * @brief Number of nodes per dimension (moneyness, T, σ)
+     */
+    [[nodiscard]] const std::array<int, 3>& nodes() const noexcept { return nodes_; }
+
+private:
+    ChebyshevBox box_{};
+    std::array<int, 3> nodes_{};
+    std::vector<double> coefficients_; ///< Row-major [moneyness][time][volatility]
+    double max_error_ = 0.0;
+
+    ChebyshevProxy() = default;
+
+    /**
+     * @brief Map x from [lo, hi] to [-1, 1]
+     */
+    [[nodiscard]] static double to_unit(double x, double lo, double hi) noexcept;
+
+    /**
+     * @brief Evaluate Σ c_k·T_k(x) with the Clenshaw recurrence
+     */
+    [[nodiscard]] static double clenshaw(const double* coefficients, int n, double x) noexcept;
+
+    /**
+     * @brief Measure the error against the pricer on the grid of Chebyshev extrema
+     */
+    void measure_error(const Pricer& pricer);
+};
+
+} // namespace BlackScholes
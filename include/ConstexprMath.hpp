@@ -0,0 +1,254 @@
+#pragma once
+
+#include "PricingKernel.hpp"
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+
+/**
+ * @file ConstexprMath.hpp
+ * @brief Compile-time elementary functions and Black-Scholes pricing
+ *
+ * <cmath> is not constexpr in C++20, so these portable implementations let
+ * reference tables, fixtures and surrogate inputs be computed by the
+ * compiler and embedded in the binary. They are accurate to a few ulp over
+ * the pricing domain but are written for clarity, not runtime speed; runtime
+ * code should keep using PricingKernel.hpp.
+ */
+
+namespace BlackScholes::Constexpr {
+
+/**
+ * @brief |x|
+ */
+[[nodiscard]] constexpr double abs(double x) noexcept {
+    return x < 0.0 ? -x : x;
+}
+
+/**
+ * @brief x·2ⁿ by repeated exact scaling (ldexp is not constexpr)
+ */
+[[nodiscard]] constexpr double scale_by_power_of_two(double x, int n) noexcept {
+    for (; n > 0; --n) {
+        x *= 2.0;
+    }
+    for (; n < 0; ++n) {
+        x *= 0.5;
+    }
+    return x;
+}
+
+/**
+ * @brief Exponential via Cody-Waite reduction e^x = 2ⁿ·e^r, |r| ≤ ln2/2, and a Taylor series
+ */
+[[nodiscard]] constexpr double exp(double x) noexcept {
+    if (x != x) {
+        return x;
+    }
+    if (x > 709.782712893384) {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (x < -745.1332191019412) {
+        return 0.0;
+    }
+
+    constexpr double ln2_hi = 6.93147180369123816490e-01;
+    constexpr double ln2_lo = 1.90821492927058770002e-10;
+    const double scaled = x * std::numbers::log2e;
+    const int n = static_cast<int>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+    const double r = (x - n * ln2_hi) - n * ln2_lo;
+
+    // |r| ≤ 0.347, so 14 terms leave a truncation error below 1e-17
+    double term = 1.0;
+    double sum = 1.0;
+    for (int k = 1; k <= 14; ++k) {
+        term *= r / k;
+        sum += term;
+    }
+    return scale_by_power_of_two(sum, n);
+}
+
+/**
+ * @brief Natural logarithm via ln x = e·ln2 + 2·atanh((m - 1)/(m + 1)), m ∈ [1/√2, √2)
+ */
+[[nodiscard]] constexpr double log(double x) noexcept {
+    if (x != x || x < 0.0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (x == 0.0) {
+        return -std::numeric_limits<double>::infinity();
+    }
+    if (x == std::numeric_limits<double>::infinity()) {
+        return x;
+    }
+
+    int e = 0;
+    while (x >= std::numbers::sqrt2) {
+        x *= 0.5;
+        ++e;
+    }
+    while (x < 0.5 * std::numbers::sqrt2) {
+        x *= 2.0;
+        --e;
+    }
+
+    // |s| ≤ 0.172, so the odd series converges by about 1.5 digits per term
+    const double s = (x - 1.0) / (x + 1.0);
+    const double s2 = s * s;
+    double power = s;
+    double sum = 0.0;
+    for (int k = 1; k <= 41; k += 2) {
+        sum += power / k;
+        power *= s2;
+    }
+    return e * std::numbers::ln2 + 2.0 * sum;
+}
+
+/**
+ * @brief Square root via exponent halving and Newton iteration
+ */
+[[nodiscard]] constexpr double sqrt(double x) noexcept {
+    if (x != x || x < 0.0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (x == 0.0 || x == std::numeric_limits<double>::infinity()) {
+        return x;
+    }
+
+    int half_exponent = 0;
+    while (x >= 2.0) {
+        x *= 0.25;
+        ++half_exponent;
+    }
+    while (x < 0.5) {
+        x *= 4.0;
+        --half_exponent;
+    }
+
+    double y = 1.0;
+    for (int i = 0; i < 6; ++i) {
+        y = 0.5 * (y + x / y);
+    }
+    return scale_by_power_of_two(y, half_exponent);
+}
+
+/**
+ * @brief Complementary error function
+ *
+ * Positive-term series erf(x) = 2/√π·e^(-x²)·Σ 2ⁿx^(2n+1)/(2n+1)!! below 0.5,
+ * where erfc(x) > 0.47 so 1 - erf(x) loses no digits, and the Laplace
+ * continued fraction above it, with enough terms to converge at every x.
+ */
+[[nodiscard]] constexpr double erfc(double x) noexcept {
+    if (x != x) {
+        return x;
+    }
+    if (x < 0.0) {
+        return 2.0 - erfc(-x);
+    }
+    if (x > 27.3) {
+        return 0.0;
+    }
+
+    constexpr double two_over_sqrt_pi = 2.0 * std::numbers::inv_sqrtpi;
+    const double x2 = x * x;
+    if (x < 0.5) {
+        double term = x;
+        double sum = x;
+        for (int n = 1; n < 120 && term > 1e-17 * sum; ++n) {
+            term *= 2.0 * x2 / (2 * n + 1);
+            sum += term;
+        }
+        return 1.0 - two_over_sqrt_pi * exp(-x2) * sum;
+    }
+
+    // erfc(x) = e^(-x²)/√π · 1/(x + (1/2)/(x + 1/(x + (3/2)/(x + ...)))), evaluated bottom-up;
+    // convergence slows like 1/x², from about 50 terms at x = 2 to 800 at x = 0.5
+    const int terms = 60 + static_cast<int>(250.0 / x2);
+    double fraction = x;
+    for (int k = terms; k >= 1; --k) {
+        fraction = x + 0.5 * k / fraction;
+    }
+
+    // e^(-x²) with x² = x2 + x2_error exactly (Dekker), so large x loses no digits
+    constexpr double splitter = 134217729.0; // 2^27 + 1
+    const double split = splitter * x;
+    const double x_hi = split - (split - x);
+    const double x_lo = x - x_hi;
+    const double x2_error = ((x_hi * x_hi - x2) + 2.0 * x_hi * x_lo) + x_lo * x_lo;
+    return std::numbers::inv_sqrtpi * exp(-x2) * (1.0 - x2_error) / fraction;
+}
+
+/**
+ * @brief Standard normal CDF
+ *
+ * Inherits erfc's accuracy, except that rounding x/√2 adds a relative
+ * error growing like x²·2⁻⁵³ far in the lower tail (about 10⁻¹³ at x = -37).
+ */
+[[nodiscard]] constexpr double normal_cdf(double x) noexcept {
+    return 0.5 * erfc(-x * (0.5 * std::numbers::sqrt2));
+}
+
+/**
+ * @brief Standard normal PDF
+ */
+[[nodiscard]] constexpr double normal_pdf(double x) noexcept {
+    constexpr double inv_sqrt_2pi = 0.5 * std::numbers::sqrt2 * std::numbers::inv_sqrtpi;
+    return inv_sqrt_2pi * exp(-0.5 * x * x);
+}
+
+/**
+ * @brief Call and put prices of a single contract under a carry model
+ * @tparam Variant BlackScholesMerton, Black76 or GarmanKohlhagen
+ */
+template <class Variant = BlackScholesMerton>
+[[nodiscard]] constexpr Kernel::OptionValues value(double S, double K, double T,
+                                                   double r, double q, double sigma) noexcept {
+    const double b = Variant::carry(r, q);
+    const double sigma_sqrt_T = sigma * sqrt(T);
+    const double d1 = (log(S / K) + (b + 0.5 * sigma * sigma) * T) / sigma_sqrt_T;
+    const double d2 = d1 - sigma_sqrt_T;
+
+    const double S_carry = S * exp((b - r) * T);
+    const double K_discount = K * exp(-r * T);
+
+    return Kernel::OptionValues{
+        .call_price = S_carry * normal_cdf(d1) - K_discount * normal_cdf(d2),
+        .put_price = K_discount * normal_cdf(-d2) - S_carry * normal_cdf(-d1)
+    };
+}
+
+/**
+ * @brief Compile-time price curve over evenly spaced underlying prices
+ *
+ * Usable as `constexpr auto table = Constexpr::price_curve<64>(...)`.
+ *
+ * @tparam N Number of points (≥ 2)
+ * @param start_price First underlying price
+ * @param end_price Last underlying price
+ */
+template <std::size_t N, class Variant = BlackScholesMerton>
+[[nodiscard]] constexpr std::array<Kernel::OptionValues, N> price_curve(double start_price, double end_price,
+                                                                       double K, double T, double r,
+                                                                       double q, double sigma) noexcept {
+    static_assert(N >= 2, "A price curve needs at least two points");
+    std::array<Kernel::OptionValues, N> curve{};
+    const double step = (end_price - start_price) / static_cast<double>(N - 1);
+    for (std::size_t i = 0; i < N; ++i) {
+        curve[i] = value<Variant>(start_price + static_cast<double>(i) * step, K, T, r, q, sigma);
+    }
+    return curve;
+}
+
+// Compile-time self-checks against known values
+static_assert(abs(exp(1.0) - std::numbers::e) < 1e-15);
+static_assert(abs(log(std::numbers::e) - 1.0) < 1e-15);
+static_assert(abs(sqrt(2.0) - std::numbers::sqrt2) < 1e-15);
+static_assert(abs(erfc(1.0) / 1.57299207050285130659e-01 - 1.0) < 1e-15);
+static_assert(abs(erfc(2.45) / 5.30580112251053907845e-04 - 1.0) < 1e-15);
+static_assert(abs(erfc(10.0) / 2.08848758376254475700e-45 - 1.0) < 1e-15);
+static_assert(normal_cdf(0.0) == 0.5);
+static_assert(abs(normal_cdf(1.959963984540054) - 0.975) < 1e-15);
+
+} // namespace BlackScholes::Constexpr
@@ -0,0 +1,256 @@
+#pragma once
+
+#include "PricingKernel.hpp"
+#include <cmath>
+#include <span>
+
+/**
+ * @file DoubleDouble.hpp
+ * @brief Double-double arithmetic and an extended-precision pricing backend
+ *
+ * A DoubleDouble is the unevaluated sum hi + lo of two doubles with
+ * |lo| ≤ ulp(hi)/2, carrying about 106 bits (32 significant digits) with
+ * error-free transformations on ordinary double hardware. The pricing
+ * functions here mirror Kernel::price with exp, log, sqrt and erfc evaluated
+ * to double-double accuracy, so deep out-of-the-money tails keep their
+ * relative accuracy and results can serve as reference values. Expect about
+ * 50× the cost of the inline double kernel per contract with Greeks.
+ *
+ * The error terms rely on strict IEEE evaluation: do not build with
+ * -ffast-math or anything else that reassociates floating-point sums.
+ */
+
+namespace BlackScholes::HighPrecision {
+
+/**
+ * @brief Unevaluated sum hi + lo of two non-overlapping doubles
+ */
+struct DoubleDouble {
+    double hi = 0.0;  ///< Leading part, the value rounded to double
+    double lo = 0.0;  ///< Rounding error of hi
+
+    constexpr DoubleDouble() noexcept = default;
+
+    /**
+     * @brief Exact conversion from double
+     */
+    constexpr DoubleDouble(double value) noexcept : hi(value) {}
+
+    /**
+     * @brief From an already normalized pair
+     */
+    constexpr DoubleDouble(double high, double low) noexcept : hi(high), lo(low) {}
+
+    /**
+     * @brief Round to the nearest double
+     */
+    [[nodiscard]] explicit constexpr operator double() const noexcept { return hi + lo; }
+};
+
+/**
+ * @brief a + b exactly as a double-double (Knuth's two-sum)
+ */
+[[nodiscard]] constexpr DoubleDouble two_sum(double a, double b) noexcept {
+    const double s = a + b;
+    const double bb = s - a;
+    return DoubleDouble(s, (a - (s - bb)) + (b - bb));
+}
+
+/**
+ * @brief a + b exactly, given |a| ≥ |b| (Dekker's fast two-sum)
+ */
+[[nodiscard]] constexpr DoubleDouble quick_two_sum(double a, double b) noexcept {
+    const double s = a + b;
+    return DoubleDouble(s, b - (s - a));
+}
+
+/**
+ * @brief a·b exactly as a double-double
+ *
+ * One fused multiply-add where the target has it in hardware, otherwise
+ * Dekker's product on 26-bit halves (exact for |a|, |b| below 2⁹⁹⁶) rather
+ * than a call into a software fma.
+ */
+[[nodiscard]] inline DoubleDouble two_prod(double a, double b) noexcept {
+    const double p = a * b;
+#if defined(FP_FAST_FMA)
+    return DoubleDouble(p, std::fma(a, b, -p));
+#else
+    constexpr double splitter = 134217729.0; // 2^27 + 1
+    const double ta = splitter * a;
+    const double a_hi = ta - (ta - a);
+    const double a_lo = a - a_hi;
+    const double tb = splitter * b;
+    const double b_hi = tb - (tb - b);
+    const double b_lo = b - b_hi;
+    return DoubleDouble(p, ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo);
+#endif
+}
+
+[[nodiscard]] constexpr DoubleDouble operator-(const DoubleDouble& a) noexcept {
+    return DoubleDouble(-a.hi, -a.lo);
+}
+
+[[nodiscard]] constexpr DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b) noexcept {
+    DoubleDouble s = two_sum(a.hi, b.hi);
+    const DoubleDouble t = two_sum(a.lo, b.lo);
+    s = quick_two_sum(s.hi, s.lo + t.hi);
+    return quick_two_sum(s.hi, s.lo + t.lo);
+}
+
+[[nodiscard]] constexpr DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b) noexcept {
+    return a + (-b);
+}
+
+[[nodiscard]] inline DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b) noexcept {
+    const DoubleDouble p = two_prod(a.hi, b.hi);
+    return quick_two_sum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+}
+
+[[nodiscard]] inline DoubleDouble operator*(const DoubleDouble& a, double b) noexcept {
+    const DoubleDouble p = two_prod(a.hi, b);
+    return quick_two_sum(p.hi, p.lo + a.lo * b);
+}
+
+[[nodiscard]] inline DoubleDouble operator*(double a, const DoubleDouble& b) noexcept {
+    return b * a;
+}
+
+[[nodiscard]] inline DoubleDouble operator/(const DoubleDouble& a, double b) noexcept {
+    const double q1 = a.hi / b;
+    const DoubleDouble remainder = a - two_prod(q1, b);
+    return quick_two_sum(q1, remainder.hi / b);
+}
+
+[[nodiscard]] inline DoubleDouble operator/(const DoubleDouble& a, const DoubleDouble& b) noexcept {
+    // Long division: three double quotient digits, each correcting the remainder
+    const double q1 = a.hi / b.hi;
+    DoubleDouble remainder = a - q1 * b;
+    const double q2 = remainder.hi / b.hi;
+    remainder = remainder - q2 * b;
+    const double q3 = remainder.hi / b.hi;
+    return quick_two_sum(q1, q2) + q3;
+}
+
+inline DoubleDouble& operator+=(DoubleDouble& a, const DoubleDouble& b) noexcept { return a = a + b; }
+inline DoubleDouble& operator-=(DoubleDouble& a, const DoubleDouble& b) noexcept { return a = a - b; }
+inline DoubleDouble& operator*=(DoubleDouble& a, const DoubleDouble& b) noexcept { return a = a * b; }
+inline DoubleDouble& operator/=(DoubleDouble& a, const DoubleDouble& b) noexcept { return a = a / b; }
+
+[[nodiscard]] constexpr bool operator<(const DoubleDouble& a, const DoubleDouble& b) noexcept {
+    return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+}
+
+[[nodiscard]] constexpr bool operator>(const DoubleDouble& a, const DoubleDouble& b) noexcept {
+    return b < a;
+}
+
+/**
+ * @brief |a|
+ */
+[[nodiscard]] constexpr DoubleDouble abs(const DoubleDouble& a) noexcept {
+    return a.hi < 0.0 ? -a : a;
+}
+
+/**
+ * @brief a·2ⁿ, exact unless the result underflows
+ */
+[[nodiscard]] inline DoubleDouble ldexp(const DoubleDouble& a, int n) noexcept {
+    return DoubleDouble(std::ldexp(a.hi, n), std::ldexp(a.lo, n));
+}
+
+/**
+ * @brief Square root by one Newton correction of the double estimate (Karp-Markstein)
+ */
+[[nodiscard]] DoubleDouble sqrt(const DoubleDouble& a) noexcept;
+
+/**
+ * @brief eˣ via reduction e^x = 2ᵏ·(e^(r/1024))^1024 and a Taylor series for e^r - 1
+ */
+[[nodiscard]] DoubleDouble exp(const DoubleDouble& a) noexcept;
+
+/**
+ * @brief Natural logarithm by one Newton step x + a·e^(-x) - 1 from the double logarithm
+ */
+[[nodiscard]] DoubleDouble log(const DoubleDouble& a) noexcept;
+
+/**
+ * @brief Complementary error function
+ *
+ * 1 - erf(x) from the positive-term erf series below x = 3, the even
+ * contraction of the Laplace continued fraction above it, and
+ * erfc(-x) = 2 - erfc(x). Relative error stays below 10⁻²⁶ until the result
+ * leaves the normal double range near x = 26.5.
+ */
+[[nodiscard]] DoubleDouble erfc(const DoubleDouble& x) noexcept;
+
+/**
+ * @brief Standard normal CDF, N(x) = erfc(-x/√2)/2, accurate relative to N in both tails
+ */
+[[nodiscard]] DoubleDouble normal_cdf(const DoubleDouble& x) noexcept;
+
+/**
+ * @brief Standard normal PDF
+ */
+[[nodiscard]] DoubleDouble normal_pdf(const DoubleDouble& x) noexcept;
+
+/**
+ * @brief Prices and Greeks in double-double, same fields and units as OptionPrices
+ */
+struct ExtendedPrices {
+    DoubleDouble call_price;
+    DoubleDouble put_price;
+    DoubleDouble delta_call;
+    DoubleDouble delta_put;
+    DoubleDouble gamma;
+    DoubleDouble theta_call;
+    DoubleDouble theta_put;
+    DoubleDouble vega;
+    DoubleDouble rho_call;
+    DoubleDouble rho_put;
+
+    /**
+     * @brief Every field rounded to double
+     */
+    [[nodiscard]] OptionPrices rounded() const noexcept;
+};
+
+/**
+ * @brief Price a single contract and its Greeks in double-double
+ * @tparam Variant BlackScholesMerton, Black76 or GarmanKohlhagen
+ */
+template <class Variant>
+[[nodiscard]] ExtendedPrices price_extended(double S, double K, double T,
+                                            double r, double q, double sigma) noexcept;
+
+/**
+ * @brief Double-double evaluation of Kernel::price, rounded to double
+ */
+template <class Variant>
+[[nodiscard]] OptionPrices price(double S, double K, double T,
+                                 double r, double q, double sigma) noexcept {
+    return price_extended<Variant>(S, K, T, r, q, sigma).rounded();
+}
+
+/**
+ * @brief Double-double evaluation of Kernel::value, rounded to double
+ */
+template <class Variant>
+[[nodiscard]] Kernel::OptionValues value(double S, double K, double T,
+                                         double r, double q, double sigma) noexcept;
+
+/**
+ * @brief Double-double counterpart of Kernel::price_batch
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+template <class Variant>
+void price_batch(const OptionBatch& batch, std::span<OptionPrices> out);
+
+/**
+ * @brief Double-double counterpart of Kernel::value_batch
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+template <class Variant>
+void value_batch(const OptionBatch& batch, std::span<double> call, std::span<double> put);
+
+} // namespace BlackScholes::HighPrecision
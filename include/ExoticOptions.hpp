@@ -0,0 +1,113 @@
+#pragma once
+
+#include "PricingKernel.hpp"
+#include <span>
+
+/**
+ * @file ExoticOptions.hpp
+ * @brief Closed-form barrier, digital and geometric Asian options
+ *
+ * All formulas are in cost-of-carry form with b = r - q, so Black-76
+ * (q = r) and Garman-Kohlhagen (q = r_f) inputs work unchanged. They share
+ * d₁/d₂ and the normal distribution functions with the vanilla kernel.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Knock direction and effect of a single barrier
+ */
+enum class BarrierType {
+    DownAndIn,   ///< Activated if the spot falls to the barrier
+    UpAndIn,     ///< Activated if the spot rises to the barrier
+    DownAndOut,  ///< Extinguished if the spot falls to the barrier
+    UpAndOut     ///< Extinguished if the spot rises to the barrier
+};
+
+/**
+ * @brief Single continuously monitored barrier
+ */
+struct BarrierSpec {
+    BarrierType type;    ///< Barrier kind
+    double barrier;      ///< Barrier level H (> 0)
+    double rebate = 0.0; ///< Cash rebate R: paid at the hit for out options, at expiry if never hit for in options
+};
+
+namespace Exotics {
+
+/**
+ * @brief Reiner-Rubinstein single barrier option
+ *
+ * If the spot is already through the barrier, in options are worth the
+ * vanilla and out options the undiscounted rebate.
+ *
+ * @return Option price
+ */
+[[nodiscard]] double barrier_price(OptionType type, const BarrierSpec& spec,
+                                   double S, double K, double T, double r, double q, double sigma) noexcept;
+
+/**
+ * @brief Price a batch of barrier options sharing the option type and barrier kind
+ * @param type Call or put
+ * @param barrier_type Barrier kind
+ * @param batch Structure-of-arrays contract inputs
+ * @param barriers Barrier level per contract
+ * @param rebates Rebate per contract (empty = no rebate)
+ * @param out Destination prices
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+void barrier_batch(OptionType type, BarrierType barrier_type, const OptionBatch& batch,
+                   std::span<const double> barriers, std::span<const double> rebates,
+                   std::span<double> out);
+
+/**
+ * @brief Cash-or-nothing digital paying a fixed amount if in the money at expiry
+ * @param cash Payout amount
+ * @return Call and put values
+ */
+[[nodiscard]] Kernel::OptionValues cash_or_nothing(double S, double K, double T, double r, double q,
+                                                   double sigma, double cash = 1.0) noexcept;
+
+/**
+ * @brief Asset-or-nothing digital paying the underlying if in the money at expiry
+ * @return Call and put values
+ */
+[[nodiscard]] Kernel::OptionValues asset_or_nothing(double S, double K, double T, double r, double q,
+                                                    double sigma) noexcept;
+
+/**
+ * @brief Geometric continuous average-rate option (Kemna-Vorst)
+ *
+ * Priced as a vanilla with carry (b - σ²/6)/2 and volatility σ/√3.
+ *
+ * @return Call and put values
+ */
+[[nodiscard]] Kernel::OptionValues geometric_asian(double S, double K, double T, double r, double q,
+                                                   double sigma) noexcept;
+
+/**
+ * @brief Price a batch of cash-or-nothing digitals
+ * @param batch Structure-of-arrays contract inputs
+ * @param cash Payout amount shared by the batch
+ * @param calls Destination call values
+ * @param puts Destination put values
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+void cash_or_nothing_batch(const OptionBatch& batch, double cash,
+                           std::span<double> calls, std::span<double> puts);
+
+/**
+ * @brief Price a batch of asset-or-nothing digitals
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+void asset_or_nothing_batch(const OptionBatch& batch, std::span<double> calls, std::span<double> puts);
+
+/**
+ * @brief Price a batch of geometric average-rate options
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+void geometric_asian_batch(const OptionBatch& batch, std::span<double> calls, std::span<double> puts);
+
+} // namespace Exotics
+
+} // namespace BlackScholes
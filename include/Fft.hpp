@@ -0,0 +1,42 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <span>
+
+/**
+ * @file Fft.hpp
+ * @brief In-place radix-2/4 fast Fourier transform
+ *
+ * Self-contained FFT used by the transform-based pricers; no external
+ * library is required.
+ */
+
+namespace BlackScholes::Fft {
+
+/**
+ * @brief Check whether n is a power of two (and non-zero)
+ */
+[[nodiscard]] constexpr bool is_power_of_two(std::size_t n) noexcept {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+/**
+ * @brief Forward DFT X[k] = Σ x[j]·e^(-2πi·jk/N), in place
+ *
+ * Bit-reversal permutation followed by radix-4 butterflies, with a single
+ * radix-2 stage when log₂N is odd.
+ *
+ * @param data Sequence whose length is a power of two
+ * @throws std::invalid_argument if the length is not a power of two
+ */
+void forward(std::span<std::complex<double>> data);
+
+/**
+ * @brief Inverse DFT x[j] = (1/N)·Σ X[k]·e^(2πi·jk/N), in place
+ * @param data Sequence whose length is a power of two
+ * @throws std::invalid_argument if the length is not a power of two
+ */
+void inverse(std::span<std::complex<double>> data);
+
+} // namespace BlackScholes::Fft
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include <cstddef>
+
+/**
+ * @file GreeksProxy.hpp
+ * @brief Taylor-expansion revaluation proxy with error monitoring
+ *
+ * Approximates intraday PnL from the Greeks produced by Model::calculate_prices
+ * instead of running a full revaluation for every market move.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Configuration of the proxy error monitor
+ */
+struct ProxyConfig {
+    std::size_t sample_interval = 100; ///< Full revaluation every N estimates (0 disables sampling)
+    double error_threshold = 0.01;     ///< Absolute PnL error that triggers a fallback
+};
+
+/**
+ * @brief Approximate PnL relative to the start-of-day parameters
+ */
+struct PnLEstimate {
+    double call_pnl;        ///< PnL of a long call
+    double put_pnl;         ///< PnL of a long put
+    bool full_revaluation;  ///< true if the value comes from Model::calculate_prices
+};
+
+/**
+ * @brief Proxy error statistics gathered from sampled full revaluations
+ */
+struct ProxyErrorReport {
+    std::size_t estimates = 0;    ///< Total number of estimates requested
+    std::size_t samples = 0;      ///< Number of sampled full revaluations
+    std::size_t fallbacks = 0;    ///< Number of threshold breaches
+    double max_abs_error = 0.0;   ///< Largest observed absolute error
+    double mean_abs_error = 0.0;  ///< Mean absolute error over samples
+    double last_abs_error = 0.0;  ///< Error of the most recent sample
+};
+
+/**
+ * @brief Taylor-expansion PnL proxy anchored on a set of Greeks
+ *
+ * PnL ≈ Δ·dS + ½Γ·dS² + vega·dσ + θ·dt + ρ·dr - T·S·Δ·dq, using the per-1%
+ * vega and rho and per-day theta conventions of OptionPrices; the dividend
+ * sensitivity follows from delta under Black-Scholes-Merton. Every
+ * sample_interval estimates a full revaluation is run to measure the proxy
+ * error. When the error exceeds the threshold the full value is returned
+ * and the expansion is re-anchored at the current market state.
+ */
+class GreeksProxy {
+public:
+    /**
+     * @brief Anchor the proxy on start-of-day parameters
+     * @param base Start-of-day option parameters
+     * @param config Error monitoring configuration
+     * @throws std::invalid_argument if parameters are invalid
+     */
+    explicit GreeksProxy(const OptionParameters& base, ProxyConfig config = {});
+
+    /**
+     * @brief Estimate PnL for the current market state
+     * @param current Current parameters (strike must match the base)
+     * @return Approximate or, on sampling fallback, exact PnL
+     * @throws std::invalid_argument if parameters are invalid
+     */
+    [[nodiscard]] PnLEstimate estimate(const OptionParameters& current);
+
+    /**
+     * @brief Re-anchor the expansion at the given market state
+     * @param current Parameters at which to recompute the Greeks
+     * @throws std::invalid_argument if parameters are invalid
+     */
+    void rebase(const OptionParameters& current);
+
+    /**
+     * @brief Error statistics gathered so far
+     */
+    [[nodiscard]] const ProxyErrorReport& report() const noexcept { return report_; }
+
+private:
+    ProxyConfig config_;
+    OptionPrices base_prices_;
+    OptionParameters anchor_;
+    OptionPrices anchor_prices_;
+    ProxyErrorReport report_;
+    std::size_t since_last_sample_ = 0;
+
+    /**
+     * @brief Taylor expansion around the anchor
+     */
+    [[nodiscard]] PnLEstimate taylor(const OptionParameters& current) const noexcept;
+
+    /**
+     * @brief Exact PnL from a full revaluation
+     */
+    [[nodiscard]] PnLEstimate revalue(const OptionPrices& prices) const noexcept;
+};
+
+} // namespace BlackScholes
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include "WorkerPool.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+/**
+ * @file GreeksSurface.hpp
+ * @brief Prices and Greeks over spot × volatility and spot × time grids
+ *
+ * Fills one row-major plane per OptionPrices field, ready for heatmaps.
+ * Terms that depend only on the row (σ or T) are computed once per row and
+ * ln(S/K) once per column, which leaves two normal tail evaluations and
+ * a handful of products per cell. Rows are shared out across worker threads.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Quantity swept along the rows, against spot along the columns
+ */
+enum class SurfaceAxis : std::uint8_t {
+    Volatility,  ///< σ varies by row, T fixed
+    Time         ///< T varies by row, σ fixed
+};
+
+/**
+ * @brief Grid layout of a surface
+ */
+struct SurfaceSpec {
+    SurfaceAxis axis = SurfaceAxis::Volatility;  ///< Quantity along the rows
+    double spot_min = 50.0;      ///< Underlying price of the first column
+    double spot_max = 150.0;     ///< Underlying price of the last column
+    double axis_min = 0.01;      ///< Smallest σ or T, the bottom row
+    double axis_max = 1.0;       ///< Largest σ or T, the top row
+    std::size_t columns = 256;   ///< Spot points
+    std::size_t rows = 256;      ///< σ or T points
+
+    /**
+     * @brief Positive, finite, increasing bounds and at least two points per axis
+     */
+    [[nodiscard]] bool is_valid() const noexcept;
+};
+
+/**
+ * @brief Smallest and largest value of one plane
+ */
+struct SurfaceRange {
+    double min = 0.0;
+    double max = 0.0;
+};
+
+/**
+ * @brief Parallel engine for price and Greek surfaces
+ *
+ * Buffers and worker threads are kept between calls: the threads start on
+ * the first compute() and are parked in between, so recomputing a grid of
+ * the same size neither allocates nor starts threads. Not thread-safe;
+ * compute() itself fans out.
+ */
+class GreeksSurface {
+public:
+    /**
+     * @brief Create an engine
+     * @param num_threads Worker threads (0 = hardware concurrency)
+     * @param resource Memory resource for the planes and per-row scratch
+     */
+    explicit GreeksSurface(unsigned num_threads = 0,
+                           std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Price every grid point under Black-Scholes-Merton
+     *
+     * base supplies K, r, q and whichever of σ and T is not swept; its
+     * underlying price is ignored. Row 0 is axis_max, so planes are laid out
+     * top row first as image-style plots expect.
+     *
+     * @param base Fixed inputs
+     * @param spec Grid layout
+     * @throws std::invalid_argument if base or spec is invalid
+     */
+    void compute(const OptionParameters& base, const SurfaceSpec& spec);
+
+    /**
+     * @brief Layout of the last computed grid
+     */
+    [[nodiscard]] const SurfaceSpec& spec() const noexcept { return spec_; }
+
+    /**
+     * @brief true until compute() has succeeded
+     */
+    [[nodiscard]] bool empty() const noexcept { return values_.empty(); }
+
+    /**
+     * @brief Row-major values of one field, rows × columns, in Model::calculate_prices units
+     */
+    [[nodiscard]] std::span<const double> plane(OptionField field) const noexcept;
+
+    /**
+     * @brief Value range of one field, for a color scale
+     */
+    [[nodiscard]] SurfaceRange range(OptionField field) const noexcept {
+        return ranges_[static_cast<std::size_t>(field)];
+    }
+
+private:
+    unsigned num_threads_;
+    SurfaceSpec spec_{};
+    std::pmr::vector<double> values_;             ///< option_field_count planes back to back
+    std::pmr::vector<double> spots_;              ///< Column underlying prices
+    std::pmr::vector<double> log_moneyness_;      ///< Column ln(S/K)
+    std::pmr::vector<SurfaceRange> row_ranges_;   ///< Per-row ranges, rows × fields
+    std::array<SurfaceRange, option_field_count> ranges_{};
+    std::unique_ptr<WorkerPool> workers_;         ///< Started by the first compute()
+};
+
+} // namespace BlackScholes
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include <complex>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+/**
+ * @file HestonModel.hpp
+ * @brief Heston stochastic-volatility pricer using the Fang-Oosterlee COS method
+ *
+ * The characteristic function is evaluated once per expiry and shared by all
+ * strikes of that expiry, which are then priced in a single vectorized pass.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Heston model parameters
+ */
+struct HestonParameters {
+    double kappa;          ///< Mean-reversion speed of the variance (κ > 0)
+    double theta;          ///< Long-run variance (θ > 0)
+    double vol_of_vol;     ///< Volatility of the variance (ξ > 0)
+    double rho;            ///< Spot/variance correlation, in (-1, 1)
+    double initial_variance; ///< Current variance v₀ (> 0)
+
+    /**
+     * @brief Validate all parameters
+     * @return true if all parameters are valid
+     */
+    [[nodiscard]] bool is_valid() const noexcept;
+};
+
+/**
+ * @brief COS-method Heston pricer for European options
+ *
+ * Prices use S, T, r and the dividend yield from OptionParameters; its
+ * volatility field is ignored in favour of the Heston variance process.
+ * Calls are obtained from puts by put-call parity for numerical stability.
+ */
+class HestonCosPricer {
+public:
+    /**
+     * @brief Create a pricer
+     * @param params Heston model parameters
+     * @param num_terms Number of cosine terms N
+     * @param truncation Half-width L of the range c₁ ± L·√(c₂ + √|c₄|)
+     * @throws std::invalid_argument if parameters are invalid
+     */
+    explicit HestonCosPricer(const HestonParameters& params, int num_terms = 256, double truncation = 12.0);
+
+    /**
+     * @brief Price every strike of one expiry in a single pass
+     * @param base Parameters providing S, T, r and q (strike and volatility ignored)
+     * @param strikes Strikes to price (each > 0)
+     * @param calls Destination call prices
+     * @param puts Destination put prices
+     * @param resource Memory resource for the per-strike and per-term scratch
+     * @throws std::invalid_argument if inputs are invalid or spans mismatch
+     */
+    void price_slice(const OptionParameters& base,
+                     std::span<const double> strikes,
+                     std::span<double> calls,
+                     std::span<double> puts,
+                     std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+    /**
+     * @brief Price a single European call
+     * @param params Option parameters (volatility ignored)
+     * @return Call option price
+     */
+    [[nodiscard]] double call_price(const OptionParameters& params) const;
+
+    /**
+     * @brief Price a single European put
+     * @param params Option parameters (volatility ignored)
+     * @return Put option price
+     */
+    [[nodiscard]] double put_price(const OptionParameters& params) const;
+
+    /**
+     * @brief Characteristic function of ln(S_T / S_0)
+     * @param u Transform variable (may be complex)
+     * @param T Time to expiration
+     * @param carry Drift of the log price, r - q
+     * @return E[exp(i·u·ln(S_T/S_0))]
+     */
+    [[nodiscard]] std::complex<double> characteristic_function(std::complex<double> u,
+                                                               double T, double carry) const noexcept;
+
+    /**
+     * @brief Model parameters
+     */
+    [[nodiscard]] const HestonParameters& parameters() const noexcept { return params_; }
+
+private:
+    HestonParameters params_;
+    int num_terms_;
+    double truncation_;
+};
+
+} // namespace BlackScholes
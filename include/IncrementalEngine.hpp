@@ -0,0 +1,126 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include <cstddef>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file IncrementalEngine.hpp
+ * @brief Incremental re-pricing of an option book on market-data ticks
+ *
+ * Positions are indexed by underlying and by discount curve so that a tick
+ * only reprices the rows that depend on it. Terms that do not depend on the
+ * underlying price are cached per position and reused across spot ticks.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Book of options repriced incrementally as market data changes
+ *
+ * The cost of a tick is proportional to the number of positions that depend
+ * on the changed input, not to the size of the book. Not thread-safe; use one
+ * engine per pricing thread.
+ */
+class IncrementalEngine {
+public:
+    using PositionId = std::size_t;
+
+    /**
+     * @brief Add a position and price it immediately
+     * @param underlying Identifier of the underlying asset
+     * @param curve Identifier of the discount curve providing r
+     * @param params Validated option parameters
+     * @return Identifier of the new position
+     * @throws std::invalid_argument if parameters are invalid
+     */
+    PositionId add_position(const std::string& underlying,
+                            const std::string& curve,
+                            const OptionParameters& params);
+
+    /**
+     * @brief Apply a spot tick to every position on an underlying
+     * @param underlying Identifier of the underlying asset
+     * @param spot New underlying price (must be > 0)
+     * @return Positions that were repriced (valid until the next add_position)
+     * @throws std::invalid_argument if spot is invalid
+     */
+    std::span<const PositionId> update_spot(const std::string& underlying, double spot);
+
+    /**
+     * @brief Apply a rate change to every position discounted on a curve
+     * @param curve Identifier of the discount curve
+     * @param rate New risk-free rate
+     * @return Positions that were repriced (valid until the next add_position)
+     * @throws std::invalid_argument if rate is not finite
+     */
+    std::span<const PositionId> update_rate(const std::string& curve, double rate);
+
+    /**
+     * @brief Change the volatility of a single position
+     * @param id Position identifier
+     * @param sigma New volatility (must be > 0)
+     * @throws std::invalid_argument if sigma is invalid
+     * @throws std::out_of_range if id is unknown
+     */
+    void update_volatility(PositionId id, double sigma);
+
+    /**
+     * @brief Latest prices and Greeks of a position
+     * @param id Position identifier
+     * @return Pricing results as produced by Model::calculate_prices
+     */
+    [[nodiscard]] const OptionPrices& prices(PositionId id) const { return prices_.at(id); }
+
+    /**
+     * @brief Current parameters of a position
+     * @param id Position identifier
+     * @return Option parameters including the latest spot and rate
+     */
+    [[nodiscard]] const OptionParameters& parameters(PositionId id) const { return params_.at(id); }
+
+    /**
+     * @brief Number of positions in the book
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return params_.size(); }
+
+private:
+    /**
+     * @brief Per-position terms that are independent of the underlying price
+     */
+    struct CachedTerms {
+        double log_strike;        ///< ln(K)
+        double discounted_strike; ///< K·e^(-rT)
+        double dividend_factor;   ///< e^(-qT)
+        double sqrt_T;            ///< √T
+        double sigma_sqrt_T;      ///< σ√T
+        double drift_T;           ///< (r - q + σ²/2)·T
+    };
+
+    std::vector<OptionParameters> params_;
+    std::vector<CachedTerms> terms_;
+    std::vector<OptionPrices> prices_;
+    std::unordered_map<std::string, std::vector<PositionId>> by_underlying_;
+    std::unordered_map<std::string, std::vector<PositionId>> by_curve_;
+
+    /**
+     * @brief Build the cached terms for a set of parameters
+     */
+    [[nodiscard]] static CachedTerms make_terms(const OptionParameters& params) noexcept;
+
+    /**
+     * @brief Price one position from its cached terms
+     * @param params Current parameters
+     * @param terms Cached S-independent terms
+     * @param log_S ln(S), shared by all positions on the same underlying
+     * @return Prices and Greeks in the units used by Model::calculate_prices
+     */
+    [[nodiscard]] static OptionPrices price_row(const OptionParameters& params,
+                                                const CachedTerms& terms,
+                                                double log_S) noexcept;
+};
+
+} // namespace BlackScholes
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <thread>
+
+/**
+ * @file Instrumentation.hpp
+ * @brief Opt-in call counts and latency histograms for the hot paths
+ *
+ * Each thread records into its own histograms with plain relaxed stores;
+ * snapshot() merges every thread's data on demand, including threads that
+ * have exited. While disabled a probe costs one relaxed load and a branch.
+ * Snapshots export in the Prometheus text exposition format to a file or
+ * over a local HTTP socket.
+ */
+
+namespace BlackScholes::Instrumentation {
+
+/**
+ * @brief Instrumented call sites
+ */
+enum class Probe : std::uint8_t {
+    CalculatePrices,  ///< Model::calculate_prices
+    PriceCurve,       ///< Model::generate_price_curve (items = points)
+    BatchPricing,     ///< Kernel::price_batch / value_batch (items = rows)
+    BatchValidation,  ///< validate_batch (items = rows)
+    VaRRun,           ///< VaREngine::run (items = scenarios)
+    Calibration,      ///< SVI and SABR calibrate (items = slices)
+    SurfaceGrid,      ///< GreeksSurface::compute (items = cells)
+    CurveRefine,      ///< ProgressiveCurve background refinement (items = points priced)
+    GuiFrame,         ///< OptionPricerGUI::render
+    GuiCalculate,     ///< PricerModel repricing
+    GuiPlotUpdate,    ///< PricerModel price curve request (items = points priced before returning)
+    GuiPlotRender,    ///< OptionPricerGUI::render_plot_panel
+    Count             ///< Number of probes
+};
+
+inline constexpr std::size_t probe_count = static_cast<std::size_t>(Probe::Count);
+
+/**
+ * @brief Snake-case probe name used as the Prometheus label value
+ */
+[[nodiscard]] std::string_view probe_name(Probe probe) noexcept;
+
+/**
+ * @brief Log-linear (HDR-style) latency histogram in nanoseconds
+ *
+ * Values below 16 ns are exact; above that every power of two is split into
+ * 16 buckets, bounding the relative error at 6.25% from nanoseconds up to
+ * about 36 minutes. Bucket edges fall on powers of two, so cumulative
+ * counts at power-of-two boundaries are exact.
+ */
+class LatencyHistogram {
+public:
+    static constexpr int sub_bucket_bits = 4;
+    static constexpr std::size_t sub_buckets = std::size_t{1} << sub_bucket_bits;
+    static constexpr int max_exponent = 41;  ///< Values of 2^41 ns and above share the last bucket
+    static constexpr std::size_t bucket_count = (max_exponent - sub_bucket_bits + 1) * sub_buckets;
+
+    /**
+     * @brief Bucket holding a value
+     */
+    [[nodiscard]] static std::size_t bucket_index(std::uint64_t nanoseconds) noexcept;
+
+    /**
+     * @brief Exclusive upper edge of a bucket in nanoseconds
+     */
+    [[nodiscard]] static std::uint64_t bucket_upper_bound(std::size_t index) noexcept;
+
+    /**
+     * @brief Record one call
+     * @param nanoseconds Call latency
+     * @param items Rows, points or scenarios processed by the call
+     */
+    void record(std::uint64_t nanoseconds, std::uint64_t items = 1) noexcept;
+
+    /**
+     * @brief Add another histogram's data to this one
+     */
+    void merge(const LatencyHistogram& other) noexcept;
+
+    /**
+     * @brief Discard all recorded data
+     */
+    void reset() noexcept { *this = LatencyHistogram{}; }
+
+    [[nodiscard]] std::uint64_t count() const noexcept { return count_; }          ///< Number of calls
+    [[nodiscard]] std::uint64_t items() const noexcept { return items_; }          ///< Items processed
+    [[nodiscard]] std::uint64_t total_ns() const noexcept { return total_ns_; }    ///< Sum of latencies
+    [[nodiscard]] std::uint64_t min_ns() const noexcept { return count_ ? min_ns_ : 0; } ///< Fastest call
+    [[nodiscard]] std::uint64_t max_ns() const noexcept { return max_ns_; }        ///< Slowest call
+
+    /**
+     * @brief Mean latency in nanoseconds (0 when empty)
+     */
+    [[nodiscard]] double mean_ns() const noexcept {
+        return count_ ? static_cast<double>(total_ns_) / static_cast<double>(count_) : 0.0;
+    }
+
+    /**
+     * @brief Latency at a quantile, reported as the containing bucket's upper edge
+     * @param quantile Quantile in [0, 1]
+     * @return Latency in nanoseconds, clamped to max_ns() (0 when empty)
+     */
+    [[nodiscard]] std::uint64_t value_at_quantile(double quantile) const noexcept;
+
+    /**
+     * @brief Number of calls whose latency is below a bucket edge
+     * @param upper_ns A value returned by bucket_upper_bound()
+     */
+    [[nodiscard]] std::uint64_t count_below(std::uint64_t upper_ns) const noexcept;
+
+private:
+    friend class Recorder;
+
+    std::array<std::uint64_t, bucket_count> buckets_{};
+    std::uint64_t count_ = 0;
+    std::uint64_t items_ = 0;
+    std::uint64_t total_ns_ = 0;
+    std::uint64_t min_ns_ = UINT64_MAX;
+    std::uint64_t max_ns_ = 0;
+};
+
+/**
+ * @brief Merged view of every thread's histograms
+ */
+struct Snapshot {
+    std::array<LatencyHistogram, probe_count> histograms;
+
+    [[nodiscard]] const LatencyHistogram& operator[](Probe probe) const noexcept {
+        return histograms[static_cast<std::size_t>(probe)];
+    }
+};
+
+namespace Detail {
+inline std::atomic<bool> enabled_flag{false};
+} // namespace Detail
+
+/**
+ * @brief Turn recording on or off for all threads
+ */
+inline void set_enabled(bool enabled) noexcept {
+    Detail::enabled_flag.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Check whether recording is on
+ */
+[[nodiscard]] inline bool enabled() noexcept {
+    return Detail::enabled_flag.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Record a call on the calling thread's histograms
+ */
+void record(Probe probe, std::uint64_t nanoseconds, std::uint64_t items = 1) noexcept;
+
+/**
+ * @brief Merge the histograms of all live and exited threads
+ */
+[[nodiscard]] Snapshot snapshot();
+
+/**
+ * @brief Discard everything recorded so far
+ *
+ * Calls recorded concurrently with a reset may be partly kept.
+ */
+void reset() noexcept;
+
+/**
+ * @brief Times the enclosing scope into a probe when recording is on
+ */
+class ScopedTimer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Start timing
+     * @param probe Probe to record into
+     * @param items Items processed by the scope (adjustable with set_items)
+     */
+    explicit ScopedTimer(Probe probe, std::uint64_t items = 1) noexcept
+        : probe_(probe), items_(items), active_(enabled())
+    {
+        if (active_) {
+            start_ = Clock::now();
+        }
+    }
+
+    ~ScopedTimer() {
+        if (active_) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_);
+            record(probe_, static_cast<std::uint64_t>(elapsed.count()), items_);
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    /**
+     * @brief Set the item count once it is known, e.g. after reading input
+     */
+    void set_items(std::uint64_t items) noexcept { items_ = items; }
+
+private:
+    Probe probe_;
+    std::uint64_t items_;
+    bool active_;
+    Clock::time_point start_{};
+};
+
+/**
+ * @brief Write a snapshot in the Prometheus text exposition format (version 0.0.4)
+ *
+ * Emits a `blackscholes_latency_seconds` histogram with power-of-four
+ * buckets from 64 ns to 69 s, `blackscholes_latency_quantile_seconds`
+ * gauges for p50/p90/p99/p99.9 and a `blackscholes_items_total` counter,
+ * all labelled by probe. Probes with no calls are omitted.
+ */
+void write_prometheus(std::ostream& out, const Snapshot& snapshot);
+
+/**
+ * @brief Write the current snapshot to a file for a textfile collector
+ *
+ * Writes to path + ".tmp" and renames over path, so scrapers never see a
+ * partial file.
+ *
+ * @throws std::runtime_error if the file cannot be written
+ */
+void export_prometheus(const std::string& path);
+
+/**
+ * @brief Minimal HTTP endpoint serving the current snapshot on localhost
+ *
+ * Every request on the port, whatever its path, is answered with the
+ * Prometheus text of a fresh snapshot. Serves from one background thread
+ * until destroyed. POSIX only.
+ */
+class MetricsServer {
+public:
+    /**
+     * @brief Start serving
+     * @param port TCP port on 127.0.0.1 (0 picks a free port)
+     * @throws std::runtime_error if the socket cannot be opened or bound
+     */
+    explicit MetricsServer(std::uint16_t port);
+
+    ~MetricsServer();
+
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    /**
+     * @brief Port actually bound
+     */
+    [[nodiscard]] std::uint16_t port() const noexcept { return port_; }
+
+private:
+    int listen_fd_ = -1;
+    std::uint16_t port_ = 0;
+    std::jthread worker_;
+
+    void serve(std::stop_token stop);
+};
+
+} // namespace BlackScholes::Instrumentation
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+/**
+ * @file LevenbergMarquardt.hpp
+ * @brief Small fixed-size Levenberg-Marquardt solver shared by the smile calibrators
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Calibration settings
+ */
+struct CalibrationConfig {
+    int max_iterations = 100;  ///< Levenberg-Marquardt iteration cap
+    double tolerance = 1e-12;  ///< Relative cost improvement treated as converged
+    unsigned num_threads = 0;  ///< Worker threads for slice fits (0 = hardware concurrency)
+};
+
+namespace Detail {
+
+/**
+ * @brief Result of a Levenberg-Marquardt run
+ */
+template <std::size_t N>
+struct LmOutcome {
+    std::array<double, N> params;
+    double cost;
+    int iterations;
+    bool converged;  ///< Tolerance or an exact fit reached; false when the step stalled
+};
+
+/**
+ * @brief Solve the N×N system A·x = b in place (Gaussian elimination, partial pivoting)
+ * @return false if the matrix is singular
+ */
+template <std::size_t N>
+inline bool solve_dense(std::array<std::array<double, N>, N>& A, std::array<double, N>& b) {
+    for (std::size_t col = 0; col < N; ++col) {
+        std::size_t pivot = col;
+        for (std::size_t row = col + 1; row < N; ++row) {
+            if (std::abs(A[row][col]) > std::abs(A[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (std::abs(A[pivot][col]) < 1e-300) {
+            return false;
+        }
+        std::swap(A[col], A[pivot]);
+        std::swap(b[col], b[pivot]);
+
+        for (std::size_t row = col + 1; row < N; ++row) {
+            const double factor = A[row][col] / A[col][col];
+            for (std::size_t k = col; k < N; ++k) {
+                A[row][k] -= factor * A[col][k];
+            }
+            b[row] -= factor * b[col];
+        }
+    }
+    for (std::size_t col = N; col-- > 0;) {
+        for (std::size_t k = col + 1; k < N; ++k) {
+            b[col] -= A[col][k] * b[k];
+        }
+        b[col] /= A[col][col];
+    }
+    return true;
+}
+
+/**
+ * @brief Weighted least-squares Levenberg-Marquardt with analytic Jacobian
+ * @param model Callable (params, i, gradient&) -> model value at point i
+ * @param project Callable (params&) that enforces parameter constraints
+ *
+ * Converged when a step improves the cost by less than the relative
+ * tolerance, or when the residuals are down to rounding. A run that ends
+ * because no damping gives a lower cost is reported as not converged.
+ */
+template <std::size_t N, class Model, class Project>
+LmOutcome<N> levenberg_marquardt(std::array<double, N> params,
+                                 std::span<const double> targets,
+                                 std::span<const double> weights,
+                                 const Model& model,
+                                 const Project& project,
+                                 const CalibrationConfig& config) {
+    const std::size_t n = targets.size();
+    const auto weight = [&](std::size_t i) { return weights.empty() ? 1.0 : weights[i]; };
+    const auto cost_of = [&](const std::array<double, N>& p) {
+        std::array<double, N> unused{};
+        double cost = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const double r = model(p, i, unused) - targets[i];
+            cost += weight(i) * r * r;
+        }
+        return cost;
+    };
+
+    // Residuals at rounding level relative to the targets: nothing left to fit
+    double exact_fit = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        exact_fit += weight(i) * targets[i] * targets[i];
+    }
+    exact_fit *= 1e-28;
+
+    project(params);
+    double cost = cost_of(params);
+    double lambda = 1e-3;
+    int iteration = 0;
+    bool converged = cost <= exact_fit;
+    bool stalled = false;
+
+    while (iteration < config.max_iterations && !converged && !stalled) {
+        ++iteration;
+
+        // Normal equations JᵀWJ·δ = -JᵀWr
+        std::array<std::array<double, N>, N> jtj{};
+        std::array<double, N> jtr{};
+        std::array<double, N> grad{};
+        for (std::size_t i = 0; i < n; ++i) {
+            const double r = model(params, i, grad) - targets[i];
+            const double w = weight(i);
+            for (std::size_t a = 0; a < N; ++a) {
+                jtr[a] -= w * grad[a] * r;
+                for (std::size_t b = a; b < N; ++b) {
+                    jtj[a][b] += w * grad[a] * grad[b];
+                }
+            }
+        }
+        for (std::size_t a = 0; a < N; ++a) {
+            for (std::size_t b = 0; b < a; ++b) {
+                jtj[a][b] = jtj[b][a];
+            }
+        }
+
+        bool improved = false;
+        while (!improved && lambda < 1e12) {
+            auto system = jtj;
+            auto step = jtr;
+            for (std::size_t a = 0; a < N; ++a) {
+                system[a][a] += lambda * std::max(jtj[a][a], 1e-12);
+            }
+            if (!solve_dense(system, step)) {
+                lambda *= 10.0;
+                continue;
+            }
+
+            std::array<double, N> trial = params;
+            for (std::size_t a = 0; a < N; ++a) {
+                trial[a] += step[a];
+            }
+            project(trial);
+
+            const double trial_cost = cost_of(trial);
+            if (trial_cost < cost) {
+                converged = (cost - trial_cost) <= config.tolerance * std::max(cost, 1e-300)
+                         || trial_cost <= exact_fit;
+                params = trial;
+                cost = trial_cost;
+                lambda = std::max(lambda / 10.0, 1e-12);
+                improved = true;
+            } else {
+                lambda *= 10.0;
+            }
+        }
+
+        // No damping gives a lower cost: stop, but do not claim the tolerance was met
+        stalled = !improved;
+    }
+
+    return LmOutcome<N>{params, cost, iteration, converged};
+}
+
+} // namespace Detail
+
+} // namespace BlackScholes
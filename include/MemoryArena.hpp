@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * @file MemoryArena.hpp
+ * @brief Polymorphic memory resources for allocation-free steady states
+ *
+ * Every allocating batch and curve API accepts a std::pmr::memory_resource.
+ * ScratchArena serves per-request and per-frame scratch from one retained
+ * block, and CountingResource counts what reaches its upstream, so a test or
+ * the GUI can assert that a warmed-up loop no longer touches the heap.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Pass-through resource that counts allocations reaching it
+ *
+ * Counters are relaxed atomics, so one instance can sit upstream of several
+ * threads' arenas.
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    /**
+     * @brief Count allocations forwarded to an upstream resource
+     * @param upstream Resource that performs the allocations
+     */
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+        : upstream_(upstream) {}
+
+    CountingResource(const CountingResource&) = delete;
+    CountingResource& operator=(const CountingResource&) = delete;
+
+    /**
+     * @brief Number of allocations since construction or the last reset_counts()
+     */
+    [[nodiscard]] std::size_t allocations() const noexcept { return allocations_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Number of deallocations since construction or the last reset_counts()
+     */
+    [[nodiscard]] std::size_t deallocations() const noexcept { return deallocations_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Total bytes allocated since construction or the last reset_counts()
+     */
+    [[nodiscard]] std::size_t bytes_allocated() const noexcept { return bytes_allocated_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Bytes currently outstanding
+     */
+    [[nodiscard]] std::size_t bytes_in_use() const noexcept { return bytes_in_use_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Zero the allocation, deallocation and byte totals (bytes_in_use is kept)
+     */
+    void reset_counts() noexcept;
+
+    /**
+     * @brief Resource the allocations are forwarded to
+     */
+    [[nodiscard]] std::pmr::memory_resource* upstream() const noexcept { return upstream_; }
+
+private:
+    std::pmr::memory_resource* upstream_;
+    std::atomic<std::size_t> allocations_{0};
+    std::atomic<std::size_t> deallocations_{0};
+    std::atomic<std::size_t> bytes_allocated_{0};
+    std::atomic<std::size_t> bytes_in_use_{0};
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+/**
+ * @brief Reusable monotonic arena for per-request and per-frame scratch
+ *
+ * Allocations bump a pointer through a retained block and deallocation is a
+ * no-op. reset() rewinds the block; if the previous cycle spilled to the
+ * upstream resource, the block is first regrown to the high-water mark, so
+ * after one warm-up cycle of a given size the arena makes no upstream
+ * allocations at all. Not thread-safe: use one arena per thread.
+ */
+class ScratchArena : public std::pmr::memory_resource {
+public:
+    /**
+     * @brief Create an arena
+     * @param initial_bytes Size of the retained block
+     * @param upstream Resource for the block and for spills beyond it
+     */
+    explicit ScratchArena(std::size_t initial_bytes = 64 * 1024,
+                          std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+    ~ScratchArena() override;
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    /**
+     * @brief Release everything allocated since the last reset
+     *
+     * Invalidates all memory handed out by the arena.
+     */
+    void reset();
+
+    /**
+     * @brief Size of the retained block
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Bytes handed out since the last reset, including spills
+     */
+    [[nodiscard]] std::size_t used() const noexcept { return used_ + spilled_bytes_; }
+
+    /**
+     * @brief Largest used() seen at any reset
+     */
+    [[nodiscard]] std::size_t high_water() const noexcept { return high_water_; }
+
+private:
+    struct Spill {
+        Spill* next;
+        std::size_t bytes;
+        std::size_t alignment;
+    };
+
+    std::pmr::memory_resource* upstream_;
+    std::byte* block_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t used_ = 0;
+    Spill* spills_ = nullptr;
+    std::size_t spilled_bytes_ = 0;
+    std::size_t high_water_ = 0;
+
+    void release_spills() noexcept;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+} // namespace BlackScholes
@@ -1,9 +1,15 @@
 #pragma once
 
-#include "BlackScholesModel.hpp"
+#include "GreeksSurface.hpp"
+#include "MemoryArena.hpp"
+#include "PlotDecimation.hpp"
+#include "PricerModel.hpp"
 #include <imgui.h>
 #include <implot.h>
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 #include <string>
 
@@ -16,6 +22,10 @@ struct GLFWwindow;
  * 
  * Provides a modern, responsive GUI using Dear ImGui with real-time plotting
  * capabilities for visualizing option prices across different underlying prices.
+ * OptionPricerGUI is the view over a PricerModel: its render functions read
+ * results and record edits but never price or build series. The one thing
+ * refreshed while drawing is the decimated copy of each plotted line, since
+ * it depends on the visible range; it reuses its buffers once warmed up.
  */
 
 namespace GUI {
@@ -29,11 +39,50 @@ enum class PlotType {
     Both        ///< Show both call and put price curves
 };
 
+/**
+ * @brief Frame timing and allocation figures for the performance overlay
+ *
+ * Rolling histories live in fixed arrays, oldest first, so recording them
+ * never allocates. Stage times accumulate during a frame and are published
+ * to the last_* fields when the next frame starts.
+ */
+struct FrameStats {
+    static constexpr int history_size = 240;  ///< Frames kept in the rolling graphs
+
+    std::array<float, history_size> frame_ms{};   ///< Interval between frames
+    std::array<float, history_size> render_ms{};  ///< CPU time spent in render()
+    int history_count = 0;  ///< Valid entries, at the end of the arrays
+
+    // Stage times of the frame in progress
+    double calculate_ms = 0.0;    ///< PricerModel repricing
+    double plot_build_ms = 0.0;   ///< PricerModel curve, payoff and surface rebuilds
+    double plot_render_ms = 0.0;  ///< render_plot_panel
+    double frame_render_ms = 0.0; ///< Whole render()
+
+    // Published figures of the last complete frame
+    double last_calculate_ms = 0.0;
+    double last_plot_build_ms = 0.0;
+    double last_plot_render_ms = 0.0;
+    double last_render_ms = 0.0;
+    std::size_t last_allocations = 0;  ///< Counted heap allocations during the frame
+
+    std::size_t allocation_mark = 0;   ///< Counter value at the start of the frame
+
+    /**
+     * @brief Close the frame in progress and start a new one
+     * @param frame_interval_ms Time since the previous frame
+     * @param allocations Current value of the allocation counter
+     */
+    void begin_frame(float frame_interval_ms, std::size_t allocations) noexcept;
+};
+
 /**
  * @brief Main GUI application class
  * 
  * Manages the complete user interface including parameter input,
  * real-time calculation, and dynamic plotting of option prices.
+ * Every frame first runs PricerModel::update(), then draws; edits made
+ * while drawing take effect at the start of the next frame.
  */
 class OptionPricerGUI {
 public:
@@ -66,33 +115,41 @@ public:
      * @return true if user requested application closure
      */
     [[nodiscard]] bool should_close() const noexcept { return should_close_; }
+    
+    /**
+     * @brief Counter for every heap allocation made by the pricer's own buffers
+     *
+     * Stays flat across frames once the arenas have warmed up.
+     */
+    [[nodiscard]] const BlackScholes::CountingResource& allocation_counter() const noexcept { return heap_counter_; }
 
 private:
     // GUI State
     bool should_close_ = false;
     bool show_demo_window_ = false;
+    bool show_performance_overlay_ = false;
     bool auto_calculate_ = true;
     
-    // Input parameters with sensible defaults
-    float underlying_price_ = 100.0f;      // S
-    float strike_price_ = 105.0f;          // K  
-    float time_to_expiration_ = 1.0f;      // T (years)
-    float risk_free_rate_ = 0.05f;         // r (5%)
-    float volatility_ = 0.2f;              // σ (20%)
-    
-    // Plot configuration
+    // Display configuration
     PlotType current_plot_type_ = PlotType::Both;
-    float price_range_ = 50.0f;
-    int num_plot_points_ = 200;
+    BlackScholes::OptionField surface_field_ = BlackScholes::OptionField::CallPrice;
     bool show_greeks_ = false;
     
-    // Calculation results
-    BlackScholes::OptionPrices current_prices_{};
-    std::vector<double> plot_x_data_;
-    std::vector<double> plot_call_data_;
-    std::vector<double> plot_put_data_;
-    bool results_valid_ = false;
-    std::string error_message_;
+    // Memory: retained buffers and arenas all draw from the counted heap
+    BlackScholes::CountingResource heap_counter_;
+    BlackScholes::ScratchArena frame_arena_{16 * 1024, &heap_counter_};  // Reset every frame
+    
+    // Inputs, results and plot series
+    PricerModel model_{&heap_counter_};
+    
+    // Curves as drawn, cut down to the plot width and rebuilt only on data or view changes
+    DecimatedSeries lod_call_{&heap_counter_};
+    DecimatedSeries lod_put_{&heap_counter_};
+    DecimatedSeries lod_call_payoff_{&heap_counter_};
+    DecimatedSeries lod_put_payoff_{&heap_counter_};
+    
+    // Performance overlay
+    FrameStats frame_stats_;
     
     /**
      * @brief Render the parameter input panel
@@ -110,40 +167,45 @@ private:
     void render_plot_panel();
     
     /**
-     * @brief Render the Greeks display panel
+     * @brief Render the price and payoff curves
      */
-    void render_greeks_panel();
+    void render_price_curves();
+    
+    /**
+     * @brief Render the price/Greek heatmap over spot × volatility or spot × time
+     */
+    void render_surface_panel();
     
     /**
-     * @brief Update calculations based on current parameters
+     * @brief Render the Greeks display panel
      */
-    void update_calculations();
+    void render_greeks_panel();
     
     /**
-     * @brief Update plot data for visualization
+     * @brief Render the performance overlay window
      */
-    void update_plot_data();
+    void render_performance_overlay();
     
     /**
-     * @brief Get current parameters as BlackScholes::OptionParameters
-     * @return Option parameters object
-     * @throws std::invalid_argument if parameters are invalid
+     * @brief Bring the model up to date and fold its timings into the frame stats
      */
-    [[nodiscard]] BlackScholes::OptionParameters get_current_parameters() const;
+    void update_model();
     
     /**
      * @brief Format currency value for display
      * @param value Currency value to format
+     * @param resource Memory resource for the string
      * @return Formatted string
      */
-    [[nodiscard]] static std::string format_currency(double value);
+    [[nodiscard]] static std::pmr::string format_currency(double value, std::pmr::memory_resource* resource);
     
     /**
      * @brief Format percentage value for display
      * @param value Percentage value (as decimal)
+     * @param resource Memory resource for the string
      * @return Formatted string
      */
-    [[nodiscard]] static std::string format_percentage(double value);
+    [[nodiscard]] static std::pmr::string format_percentage(double value, std::pmr::memory_resource* resource);
     
     /**
      * @brief Show help tooltip for a parameter
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+/**
+ * @file PlotDecimation.hpp
+ * @brief Level-of-detail reduction of line series to the resolution they are drawn at
+ *
+ * A line plot cannot show more than about two distinct values per pixel
+ * column, so series much longer than the plot is wide are cut down before
+ * they reach ImPlot. Each pixel column keeps its minimum and maximum in
+ * their original order, which preserves spikes and kinks that averaging or
+ * striding would lose, and the drawn shape matches the full series.
+ */
+
+namespace GUI {
+
+/**
+ * @brief Min/max decimation of the points [first, last) into at most 2·buckets + 2 points
+ *
+ * Points are split into buckets of equal index span; each bucket contributes
+ * its smallest and largest y in x order (one point when they coincide). The
+ * first and last points are always kept so the line reaches both ends.
+ *
+ * @param x Ascending x values
+ * @param y Values at x, same length
+ * @param first First index to keep
+ * @param last One past the last index
+ * @param buckets Number of buckets, usually the plot width in pixels
+ * @param out_x Receives the kept x values (cleared first)
+ * @param out_y Receives the kept y values (cleared first)
+ */
+void decimate_min_max(std::span<const double> x, std::span<const double> y,
+                      std::size_t first, std::size_t last, std::size_t buckets,
+                      std::pmr::vector<double>& out_x, std::pmr::vector<double>& out_y);
+
+/**
+ * @brief Cached, view-dependent decimation of one line series
+ *
+ * update() is cheap when nothing has changed: the series is only rebuilt
+ * when the data version, the visible x range or the pixel width differs
+ * from the last call, so frame cost stays bounded by the plot size however
+ * long the source series is.
+ */
+class DecimatedSeries {
+public:
+    /**
+     * @param resource Memory resource for the decimated points
+     */
+    explicit DecimatedSeries(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Bring the decimated series up to date with the source and the view
+     *
+     * Only points inside [view_min, view_max], plus one on either side so the
+     * line runs to the plot edges, are considered. Series already shorter
+     * than two points per pixel are kept whole.
+     *
+     * @param x Ascending source x values
+     * @param y Source y values, same length
+     * @param version Changes whenever the source data changes
+     * @param view_min Smallest visible x
+     * @param view_max Largest visible x
+     * @param pixel_width Plot width in pixels
+     * @return true if the series was rebuilt
+     */
+    bool update(std::span<const double> x, std::span<const double> y, std::uint64_t version,
+                double view_min, double view_max, int pixel_width);
+
+    /**
+     * @brief Forget the cached series, forcing the next update() to rebuild
+     */
+    void invalidate() noexcept { valid_ = false; }
+
+    [[nodiscard]] std::span<const double> x() const noexcept { return x_; }
+    [[nodiscard]] std::span<const double> y() const noexcept { return y_; }
+
+    /**
+     * @brief Points to draw
+     */
+    [[nodiscard]] int size() const noexcept { return static_cast<int>(x_.size()); }
+
+private:
+    std::pmr::vector<double> x_;
+    std::pmr::vector<double> y_;
+    bool valid_ = false;
+    std::uint64_t version_ = 0;
+    double view_min_ = 0.0;
+    double view_max_ = 0.0;
+    int pixel_width_ = 0;
+};
+
+} // namespace GUI
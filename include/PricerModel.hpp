@@ -0,0 +1,198 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include "GreeksSurface.hpp"
+#include "ProgressiveCurve.hpp"
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @file PricerModel.hpp
+ * @brief State and computation behind the pricer GUI
+ *
+ * The GUI is split into a model and a view. The view (OptionPricerGUI)
+ * draws from the model's read-only accessors and turns edits into
+ * invalidate_*() calls; it never prices or builds series. The model does
+ * that in update(), once at the start of every frame and only for what was
+ * invalidated, so a frame without edits does no pricing at all.
+ */
+
+namespace GUI {
+
+/**
+ * @brief Everything the user can edit that feeds a computation
+ *
+ * Widgets write these fields directly; each write must be followed by the
+ * matching PricerModel::invalidate_*() call.
+ */
+struct PricerInputs {
+    float underlying_price = 100.0f;      // S
+    float strike_price = 105.0f;          // K
+    float time_to_expiration = 1.0f;      // T (years)
+    float risk_free_rate = 0.05f;         // r (5%)
+    float volatility = 0.2f;              // σ (20%)
+
+    float price_range = 50.0f;            ///< Plotted underlying range, ± around S
+    int plot_points = 200;                ///< Points in the refined price curve
+    int surface_points = 256;             ///< Grid points per axis of the Greeks surface
+    BlackScholes::SurfaceAxis surface_axis = BlackScholes::SurfaceAxis::Volatility;
+
+    /**
+     * @brief Contract inputs as BlackScholes::OptionParameters
+     * @throws std::invalid_argument if parameters are invalid
+     */
+    [[nodiscard]] BlackScholes::OptionParameters parameters() const;
+};
+
+/**
+ * @brief Time spent by one PricerModel::update() call, by stage
+ */
+struct UpdateTimings {
+    double calculate_ms = 0.0;   ///< Prices and Greeks
+    double plot_build_ms = 0.0;  ///< Price curve, payoff and surface rebuilds
+};
+
+/**
+ * @brief Inputs, results and derived plot series of the pricer
+ *
+ * Each result is tracked separately: new contract inputs invalidate
+ * everything, a new plot range or point count only the series, a new
+ * surface grid only the surface. Payoff series are rebuilt together with
+ * every change of the price curve, including its background refinement.
+ */
+class PricerModel {
+public:
+    /**
+     * @param resource Thread-safe memory resource for every retained buffer; the
+     *        price curve's background worker allocates from it too
+     */
+    explicit PricerModel(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    PricerModel(const PricerModel&) = delete;
+    PricerModel& operator=(const PricerModel&) = delete;
+
+    /**
+     * @brief Editable inputs; follow a change with the matching invalidate_*() call
+     */
+    [[nodiscard]] PricerInputs& inputs() noexcept { return inputs_; }
+    [[nodiscard]] const PricerInputs& inputs() const noexcept { return inputs_; }
+
+    /**
+     * @brief Contract inputs changed: reprice and rebuild every series
+     */
+    void invalidate_prices() noexcept { prices_dirty_ = true; }
+
+    /**
+     * @brief Plot range or point count changed: rebuild the curve and payoffs
+     */
+    void invalidate_curve() noexcept { curve_dirty_ = true; }
+
+    /**
+     * @brief Surface axis or grid size changed
+     */
+    void invalidate_surface() noexcept { surface_dirty_ = true; }
+
+    /**
+     * @brief Build the surface only while something shows it
+     */
+    void set_surface_visible(bool visible) noexcept { surface_visible_ = visible; }
+
+    /**
+     * @brief Bring every invalidated result up to date
+     *
+     * Also adopts a finished background refinement of the price curve.
+     *
+     * @return Time spent in this call, by stage
+     */
+    UpdateTimings update();
+
+    /**
+     * @brief true when the last repricing succeeded
+     */
+    [[nodiscard]] bool results_valid() const noexcept { return results_valid_; }
+
+    /**
+     * @brief Reason the last repricing failed
+     */
+    [[nodiscard]] const std::string& error_message() const noexcept { return error_message_; }
+
+    /**
+     * @brief Prices and Greeks at the current inputs
+     */
+    [[nodiscard]] const BlackScholes::OptionPrices& prices() const noexcept { return prices_; }
+
+    /**
+     * @brief |(C - P) - (S - K·e^(-rT))| at the current inputs
+     */
+    [[nodiscard]] double parity_difference() const noexcept { return parity_difference_; }
+
+    /**
+     * @brief Price curve over the plotted range, coarse while refining
+     */
+    [[nodiscard]] const BlackScholes::ProgressiveCurve& curve() const noexcept { return curve_; }
+
+    /**
+     * @brief max(0, S - K) at curve().underlying()
+     */
+    [[nodiscard]] std::span<const double> call_payoff() const noexcept { return call_payoff_; }
+
+    /**
+     * @brief max(0, K - S) at curve().underlying()
+     */
+    [[nodiscard]] std::span<const double> put_payoff() const noexcept { return put_payoff_; }
+
+    /**
+     * @brief Changes whenever the curve or payoff series change, for view caches built on them
+     */
+    [[nodiscard]] std::uint64_t series_version() const noexcept { return curve_.version(); }
+
+    /**
+     * @brief Greeks surface around the current inputs; may lag while hidden
+     */
+    [[nodiscard]] const BlackScholes::GreeksSurface& surface() const noexcept { return surface_; }
+
+    /**
+     * @brief Duration of the most recent repricing, including the curve's coarse pass
+     */
+    [[nodiscard]] double last_update_ms() const noexcept { return last_update_ms_; }
+
+    /**
+     * @brief Curve points priced per second by the most recent curve build, synchronous or background
+     */
+    [[nodiscard]] double points_per_second() const noexcept { return points_per_second_; }
+
+private:
+    PricerInputs inputs_;
+
+    // What update() still has to do
+    bool prices_dirty_ = true;
+    bool curve_dirty_ = true;
+    bool surface_dirty_ = true;
+    bool surface_visible_ = false;
+
+    // Results
+    BlackScholes::OptionPrices prices_{};
+    double parity_difference_ = 0.0;
+    bool results_valid_ = false;
+    std::string error_message_;
+
+    BlackScholes::ProgressiveCurve curve_;
+    std::pmr::vector<double> call_payoff_;
+    std::pmr::vector<double> put_payoff_;
+    std::uint64_t payoff_version_ = 0;  ///< curve_.version() the payoffs were built from
+    BlackScholes::GreeksSurface surface_;
+
+    // Figures of the most recent updates, whatever frame they ran in
+    double last_update_ms_ = 0.0;
+    double points_per_second_ = 0.0;
+
+    void update_prices(UpdateTimings& timings);
+    void update_curve(UpdateTimings& timings);
+    void update_payoffs(UpdateTimings& timings);
+    void update_surface(UpdateTimings& timings);
+};
+
+} // namespace GUI
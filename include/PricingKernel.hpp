@@ -0,0 +1,399 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include "Instrumentation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+/**
+ * @file PricingKernel.hpp
+ * @brief Inline cost-of-carry pricing kernel shared by all batch engines
+ *
+ * Generalized Black-Scholes in cost-of-carry form: the underlying drifts at
+ * rate b, so Black-Scholes-Merton (b = r - q), Black-76 (b = 0) and
+ * Garman-Kohlhagen (b = r - r_f) are all the same kernel with a different
+ * compile-time carry. Everything here is inline, so batch loops over
+ * structure-of-arrays inputs make no call per contract beyond the math
+ * library. The batch loops are scalar: the calls to std::log and std::exp
+ * and the range selection in normal_tails() keep compilers from
+ * vectorizing them, and there is no hand-written SIMD path.
+ * The carry models are templated on the number type so the double-double
+ * backend in DoubleDouble.hpp can share them.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Black-Scholes-Merton with continuous dividend yield q (b = r - q)
+ */
+struct BlackScholesMerton {
+    static constexpr bool rate_in_carry = true; ///< b moves with r
+    template <class Real>
+    [[nodiscard]] static constexpr Real carry(Real r, Real q) noexcept { return r - q; }
+};
+
+/**
+ * @brief Black-76 on a forward or futures price (b = 0)
+ *
+ * underlying_price is the forward F; the yield argument is ignored.
+ */
+struct Black76 {
+    static constexpr bool rate_in_carry = false; ///< b is fixed at zero
+    template <class Real>
+    [[nodiscard]] static constexpr Real carry(Real, Real) noexcept { return Real{}; }
+};
+
+/**
+ * @brief Garman-Kohlhagen FX options (b = r_d - r_f)
+ *
+ * risk_free_rate is the domestic rate and the yield argument the foreign rate.
+ */
+struct GarmanKohlhagen {
+    static constexpr bool rate_in_carry = true; ///< b moves with the domestic rate
+    template <class Real>
+    [[nodiscard]] static constexpr Real carry(Real r, Real r_foreign) noexcept { return r - r_foreign; }
+};
+
+/**
+ * @brief Structure-of-arrays view over a batch of contracts
+ *
+ * All spans must have the same length. Rows are assumed to be valid; screen
+ * untrusted feeds with validate_batch() from BatchValidation.hpp first.
+ */
+struct OptionBatch {
+    std::span<const double> underlying_price;    ///< S (or F for Black-76)
+    std::span<const double> strike_price;        ///< K
+    std::span<const double> time_to_expiration;  ///< T
+    std::span<const double> risk_free_rate;      ///< r
+    std::span<const double> dividend_yield;      ///< q (or r_f for Garman-Kohlhagen)
+    std::span<const double> volatility;          ///< σ
+
+    /**
+     * @brief Number of contracts in the batch
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return underlying_price.size(); }
+
+    /**
+     * @brief Check that every column has the same length
+     */
+    [[nodiscard]] bool is_consistent() const noexcept {
+        const std::size_t n = size();
+        return strike_price.size() == n && time_to_expiration.size() == n
+            && risk_free_rate.size() == n && dividend_yield.size() == n
+            && volatility.size() == n;
+    }
+};
+
+namespace HighPrecision {
+
+// Defined in DoubleDouble.cpp for the three carry models
+template <class Variant>
+void price_batch(const OptionBatch& batch, std::span<OptionPrices> out);
+
+template <class Variant>
+void value_batch(const OptionBatch& batch, std::span<double> call, std::span<double> put);
+
+} // namespace HighPrecision
+
+namespace Kernel {
+
+/**
+ * @brief Both tail probabilities and the density of a standard normal variate
+ */
+struct NormalTails {
+    double lower;    ///< N(x)
+    double upper;    ///< N(-x) = 1 - N(x)
+    double density;  ///< φ(x), a by-product of the tail evaluation
+};
+
+/**
+ * @brief N(x), N(-x) and φ(x) from one complementary error function, inline form
+ *
+ * W. J. Cody's rational approximations (Math. Comp. 23, 1969) for erfc(z),
+ * z = |x|/√2: 1 - z·P(z²)/Q(z²) below z = 0.46875, e^(-z²)·P(z)/Q(z) up to 4
+ * and e^(-z²)/z·(1/√π - R(1/z²)) beyond, the last rewritten in z² so every
+ * range ends in the same single division. The smaller tail is computed
+ * directly and e^(-x²/2) is corrected for the rounding of x², so both tails
+ * keep a relative error below 10⁻¹⁵ until they leave the normal double range
+ * near |x| = 37.5. All three ranges are evaluated and the result is picked
+ * by x, so the cost does not depend on the argument. This is the scalar
+ * form only; it does not make the loops calling it vectorizable, and
+ * there is no SIMD form.
+ */
+[[nodiscard]] inline NormalTails normal_tails(double x) noexcept {
+    constexpr double inv_sqrt2 = 0.7071067811865476;    // 1/√2
+    constexpr double inv_sqrtpi = 0.5641895835477563;   // 1/√π
+    constexpr double inv_sqrt_2pi = 0.3989422804014327; // 1/√(2π)
+
+    // Both tails are 0 or 1 in double beyond |x| = 40; clamping keeps x² finite
+    const double ax = std::min(std::abs(x), 40.0);
+    const double z = ax * inv_sqrt2;
+    const double zz = z * z;
+
+    // erfc(z) = (Q - z·P)/Q for z < 0.46875
+    const double central_num = (((1.85777706184603153e-1 * zz + 3.16112374387056560e0) * zz
+                              + 1.13864154151050156e2) * zz + 3.77485237685302021e2) * zz
+                              + 3.20937758913846947e3;
+    const double central_den = (((zz + 2.36012909523441209e1) * zz + 2.44024637934444173e2) * zz
+                              + 1.28261652607737228e3) * zz + 2.84423683343917062e3;
+
+    // erfc(z) = e^(-z²)·P/Q for z ≤ 4
+    const double m = std::min(z, 4.0);
+    const double middle_num = (((((((2.15311535474403846e-8 * m + 5.64188496988670089e-1) * m
+                             + 8.88314979438837594e0) * m + 6.61191906371416295e1) * m
+                             + 2.98635138197400131e2) * m + 8.81952221241769090e2) * m
+                             + 1.71204761263407058e3) * m + 2.05107837782607147e3) * m
+                             + 1.23033935479799725e3;
+    const double middle_den = (((((((m + 1.57449261107098347e1) * m + 1.17693950891312499e2) * m
+                             + 5.37181101862009858e2) * m + 1.62138957456669019e3) * m
+                             + 3.29079923573345963e3) * m + 4.36261909014324716e3) * m
+                             + 3.43936767414372164e3) * m + 1.23033935480374942e3;
+
+    // erfc(z) = e^(-z²)·(Q/√π - P)/(z·Q) beyond, R(1/y) = P(y)/Q(y) with y = z²
+    const double y = std::max(zz, 16.0);
+    const double far_poly = ((((6.58749161529837803e-4 * y + 1.60837851487422766e-2) * y
+                           + 1.25781726111229246e-1) * y + 3.60344899949804439e-1) * y
+                           + 3.05326634961232344e-1) * y + 1.63153871373020978e-2;
+    const double far_base = (((((2.33520497626869185e-3 * y + 6.05183413124413191e-2) * y
+                           + 5.27905102951428412e-1) * y + 1.87295284992346725e0) * y
+                           + 2.56852019228982242e0) * y + 1.0) * y;
+
+    // e^(-x²/2) with x² = square + square_error exactly, so large |x| loses no digits
+    const double square = ax * ax;
+#if defined(FP_FAST_FMA)
+    const double square_error = std::fma(ax, ax, -square);
+#else
+    constexpr double splitter = 134217729.0; // 2^27 + 1
+    const double split = splitter * ax;
+    const double ax_hi = split - (split - ax);
+    const double ax_lo = ax - ax_hi;
+    const double square_error = ((ax_hi * ax_hi - square) + 2.0 * ax_hi * ax_lo) + ax_lo * ax_lo;
+#endif
+    const double gauss = std::exp(-0.5 * square) * (1.0 - 0.5 * square_error);
+
+    const bool central = z < 0.46875;
+    const bool middle = z <= 4.0;
+    const double num = central ? central_den - z * central_num
+                               : (middle ? middle_num : inv_sqrtpi * far_base - far_poly) * gauss;
+    const double den = central ? central_den : (middle ? middle_den : far_base * std::max(z, 4.0));
+    const double tail = 0.5 * num / den; // N(-|x|)
+
+    return NormalTails{
+        .lower = x < 0.0 ? tail : 1.0 - tail,
+        .upper = x < 0.0 ? 1.0 - tail : tail,
+        .density = inv_sqrt_2pi * gauss
+    };
+}
+
+/**
+ * @brief Standard normal CDF, inline form
+ *
+ * Accurate relative to N(x) in both tails; see normal_tails().
+ */
+[[nodiscard]] inline double normal_cdf(double x) noexcept {
+    return normal_tails(x).lower;
+}
+
+/**
+ * @brief Standard normal PDF, inline form
+ */
+[[nodiscard]] inline double normal_pdf(double x) noexcept {
+    constexpr double inv_sqrt_2pi = 0.3989422804014327; // 1/sqrt(2*π)
+    return inv_sqrt_2pi * std::exp(-0.5 * x * x);
+}
+
+/**
+ * @brief d₁ and d₂ of the generalized Black-Scholes formula
+ */
+struct DTerms {
+    double d1;  ///< (ln(S/K) + (b + σ²/2)T) / (σ√T)
+    double d2;  ///< d₁ - σ√T
+};
+
+/**
+ * @brief Compute d₁ and d₂ for a given cost of carry
+ * @param b Cost of carry (r - q for Black-Scholes-Merton)
+ */
+[[nodiscard]] inline DTerms d_terms(double S, double K, double T, double b, double sigma) noexcept {
+    const double sigma_sqrt_T = sigma * std::sqrt(T);
+    const double d1 = (std::log(S / K) + (b + 0.5 * sigma * sigma) * T) / sigma_sqrt_T;
+    return DTerms{.d1 = d1, .d2 = d1 - sigma_sqrt_T};
+}
+
+/**
+ * @brief Call and put prices without Greeks
+ */
+struct OptionValues {
+    double call_price;  ///< European call price
+    double put_price;   ///< European put price
+};
+
+/**
+ * @brief Price a single contract and its Greeks under a carry model
+ * @tparam Variant BlackScholesMerton, Black76 or GarmanKohlhagen
+ * @return Prices and Greeks in the units of Model::calculate_prices
+ */
+template <class Variant>
+[[nodiscard]] inline OptionPrices price(double S, double K, double T,
+                                        double r, double q, double sigma) noexcept {
+    const double b = Variant::carry(r, q);
+    const double sqrt_T = std::sqrt(T);
+    const double sigma_sqrt_T = sigma * sqrt_T;
+    const auto [d1, d2] = d_terms(S, K, T, b, sigma);
+
+    const auto [N_d1, N_neg_d1, phi_d1] = normal_tails(d1);
+    const NormalTails tails_d2 = normal_tails(d2);
+    const double N_d2 = tails_d2.lower;
+    const double N_neg_d2 = tails_d2.upper;
+
+    const double carry_factor = std::exp((b - r) * T); // e^((b-r)T), 1 for plain Black-Scholes
+    const double discount_factor = std::exp(-r * T);
+    const double S_carry = S * carry_factor;
+    const double K_discount = K * discount_factor;
+
+    const double call = S_carry * N_d1 - K_discount * N_d2;
+    const double put = K_discount * N_neg_d2 - S_carry * N_neg_d1;
+
+    const double time_decay = -(S_carry * phi_d1 * sigma) / (2.0 * sqrt_T);
+    const double theta_call = time_decay - (b - r) * S_carry * N_d1 - r * K_discount * N_d2;
+    const double theta_put = time_decay + (b - r) * S_carry * N_neg_d1 + r * K_discount * N_neg_d2;
+
+    // When b is pinned (Black-76) the only rate exposure is the discounting of the premium
+    double rho_call;
+    double rho_put;
+    if constexpr (Variant::rate_in_carry) {
+        rho_call = K_discount * T * N_d2;
+        rho_put = -K_discount * T * N_neg_d2;
+    } else {
+        rho_call = -T * call;
+        rho_put = -T * put;
+    }
+
+    return OptionPrices{
+        .call_price = call,
+        .put_price = put,
+        .delta_call = carry_factor * N_d1,
+        .delta_put = -carry_factor * N_neg_d1,
+        .gamma = carry_factor * phi_d1 / (S * sigma_sqrt_T),
+        .theta_call = theta_call / 365.25,                // Convert to per day
+        .theta_put = theta_put / 365.25,                  // Convert to per day
+        .vega = S_carry * phi_d1 * sqrt_T / 100.0,        // Convert to per 1% volatility change
+        .rho_call = rho_call / 100.0,                     // Convert to per 1% rate change
+        .rho_put = rho_put / 100.0                        // Convert to per 1% rate change
+    };
+}
+
+/**
+ * @brief Call and put prices of a single contract under a carry model
+ */
+template <class Variant>
+[[nodiscard]] inline OptionValues value(double S, double K, double T,
+                                        double r, double q, double sigma) noexcept {
+    const double b = Variant::carry(r, q);
+    const auto [d1, d2] = d_terms(S, K, T, b, sigma);
+
+    const NormalTails tails_d1 = normal_tails(d1);
+    const NormalTails tails_d2 = normal_tails(d2);
+
+    const double S_carry = S * std::exp((b - r) * T);
+    const double K_discount = K * std::exp(-r * T);
+
+    return OptionValues{
+        .call_price = S_carry * tails_d1.lower - K_discount * tails_d2.lower,
+        .put_price = K_discount * tails_d2.upper - S_carry * tails_d1.upper
+    };
+}
+
+/**
+ * @brief Price a batch of contracts with full Greeks
+ *
+ * Scalar loop over price<Variant>(), one contract at a time.
+ *
+ * @param batch Structure-of-arrays inputs
+ * @param out Destination, one entry per contract
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+template <class Variant>
+void price_batch(const OptionBatch& batch, std::span<OptionPrices> out) {
+    if (!batch.is_consistent() || out.size() != batch.size()) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+
+    const std::size_t n = batch.size();
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::BatchPricing, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = price<Variant>(batch.underlying_price[i], batch.strike_price[i],
+                                batch.time_to_expiration[i], batch.risk_free_rate[i],
+                                batch.dividend_yield[i], batch.volatility[i]);
+    }
+}
+
+/**
+ * @brief Price a batch of contracts into separate call and put columns
+ *
+ * Scalar loop over value<Variant>(), one contract at a time. Cheaper than
+ * price_batch() when no Greeks are needed.
+ *
+ * @param batch Structure-of-arrays inputs
+ * @param call Destination call prices
+ * @param put Destination put prices
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+template <class Variant>
+void value_batch(const OptionBatch& batch, std::span<double> call, std::span<double> put) {
+    if (!batch.is_consistent() || call.size() != batch.size() || put.size() != batch.size()) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+
+    const std::size_t n = batch.size();
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::BatchPricing, n);
+    const double* S = batch.underlying_price.data();
+    const double* K = batch.strike_price.data();
+    const double* T = batch.time_to_expiration.data();
+    const double* r = batch.risk_free_rate.data();
+    const double* q = batch.dividend_yield.data();
+    const double* sigma = batch.volatility.data();
+    double* call_out = call.data();
+    double* put_out = put.data();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const OptionValues v = value<Variant>(S[i], K[i], T[i], r[i], q[i], sigma[i]);
+        call_out[i] = v.call_price;
+        put_out[i] = v.put_price;
+    }
+}
+
+/**
+ * @brief Price a batch of contracts with full Greeks in the chosen arithmetic
+ * @param precision Precision::DoubleDouble routes the batch to HighPrecision::price_batch
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+template <class Variant>
+void price_batch(const OptionBatch& batch, std::span<OptionPrices> out, Precision precision) {
+    if (precision == Precision::DoubleDouble) {
+        HighPrecision::price_batch<Variant>(batch, out);
+    } else {
+        price_batch<Variant>(batch, out);
+    }
+}
+
+/**
+ * @brief Price a batch of contracts into call and put columns in the chosen arithmetic
+ * @param precision Precision::DoubleDouble routes the batch to HighPrecision::value_batch
+ * @throws std::invalid_argument if the spans have mismatched lengths
+ */
+template <class Variant>
+void value_batch(const OptionBatch& batch, std::span<double> call, std::span<double> put, Precision precision) {
+    if (precision == Precision::DoubleDouble) {
+        HighPrecision::value_batch<Variant>(batch, call, put);
+    } else {
+        value_batch<Variant>(batch, call, put);
+    }
+}
+
+} // namespace Kernel
+
+} // namespace BlackScholes
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+/**
+ * @file ProgressiveCurve.hpp
+ * @brief Price curve that answers at once in coarse form and refines in the background
+ *
+ * request() prices a coarse version of the curve on the calling thread and
+ * hands the full resolution to a worker thread, which prices it in chunks
+ * and abandons it as soon as a newer request arrives. The caller adopts the
+ * finished curve with poll(), so an interactive caller never waits for more
+ * than the coarse pass, however many points it asks for.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Call and put price curve over a range of underlying prices, refined in the background
+ *
+ * The curve seen through underlying(), call() and put() is owned by the
+ * calling thread and only changes inside request(), poll() and clear().
+ * The finished refinement is swapped in rather than copied, so once both
+ * buffers have grown to the curve size no further allocation happens.
+ * Not thread-safe apart from the worker it owns. Both buffers share one
+ * memory resource, which the worker allocates from while the calling
+ * thread may too, so the resource must be thread-safe.
+ */
+class ProgressiveCurve {
+public:
+    static constexpr std::size_t default_coarse_points = 256;  ///< Points priced synchronously
+    static constexpr std::size_t refine_chunk = 8192;          ///< Points priced between cancellation checks
+
+    /**
+     * @brief Create an empty curve and start its worker thread
+     * @param coarse_points Largest curve priced on the calling thread
+     * @param resource Thread-safe memory resource for the curve buffers, such as
+     *        the default resource, a CountingResource over it or a
+     *        std::pmr::synchronized_pool_resource; never a ScratchArena
+     */
+    explicit ProgressiveCurve(std::size_t coarse_points = default_coarse_points,
+                              std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    ~ProgressiveCurve();
+
+    ProgressiveCurve(const ProgressiveCurve&) = delete;
+    ProgressiveCurve& operator=(const ProgressiveCurve&) = delete;
+
+    /**
+     * @brief Replace the curve, cancelling any refinement in flight
+     *
+     * Covers the same points as Model::generate_price_curve. Curves of up to
+     * coarse_points points are complete on return; larger ones hold
+     * coarse_points evenly spaced points over the same range until poll()
+     * adopts the full resolution.
+     *
+     * @param params Base parameters (strike, time, rate, volatility, dividend)
+     * @param price_range Range around the current price
+     * @param num_points Points in the finished curve
+     * @throws std::invalid_argument if the inputs are invalid; the current curve is kept
+     */
+    void request(const OptionParameters& params, double price_range, std::size_t num_points);
+
+    /**
+     * @brief Adopt the full-resolution curve if the worker has finished it
+     * @return true if the curve changed
+     */
+    bool poll();
+
+    /**
+     * @brief Cancel any refinement and empty the curve
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Underlying prices of the current curve, ascending
+     */
+    [[nodiscard]] std::span<const double> underlying() const noexcept { return underlying_; }
+
+    /**
+     * @brief Call prices at underlying()
+     */
+    [[nodiscard]] std::span<const double> call() const noexcept { return call_; }
+
+    /**
+     * @brief Put prices at underlying()
+     */
+    [[nodiscard]] std::span<const double> put() const noexcept { return put_; }
+
+    /**
+     * @brief Points in the current curve, coarse or refined
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return underlying_.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return underlying_.empty(); }
+
+    /**
+     * @brief Points the curve will have once refined
+     */
+    [[nodiscard]] std::size_t target_points() const noexcept { return target_points_; }
+
+    /**
+     * @brief true while a coarse curve is waiting for its refinement
+     */
+    [[nodiscard]] bool refining() const noexcept { return size() < target_points_; }
+
+    /**
+     * @brief Worker time spent on the last adopted refinement, in milliseconds
+     */
+    [[nodiscard]] double last_refine_ms() const noexcept { return last_refine_ms_; }
+
+    /**
+     * @brief Changes whenever the curve seen by the caller changes, for caches built on it
+     */
+    [[nodiscard]] std::uint64_t version() const noexcept { return version_; }
+
+private:
+    /**
+     * @brief Evenly spaced underlying prices plus the fixed contract terms
+     */
+    struct Grid {
+        double start_price = 0.0;
+        double step = 0.0;
+        std::size_t points = 0;
+        double K = 0.0;
+        double T = 0.0;
+        double r = 0.0;
+        double q = 0.0;
+        double sigma = 0.0;
+    };
+
+    static Grid make_grid(const OptionParameters& params, double price_range, std::size_t num_points);
+    static void price_points(const Grid& grid, std::size_t first, std::size_t last,
+                             double* underlying, double* call, double* put) noexcept;
+
+    void run(std::stop_token stop);
+    bool refine(const Grid& grid, std::uint64_t generation, std::stop_token stop);
+
+    std::size_t coarse_points_;
+    std::size_t target_points_ = 0;
+    double last_refine_ms_ = 0.0;
+    std::uint64_t version_ = 0;
+
+    // Owned by the calling thread
+    std::pmr::vector<double> underlying_;
+    std::pmr::vector<double> call_;
+    std::pmr::vector<double> put_;
+
+    // Owned by the worker while ready_ is false, by poll() once it is set
+    std::pmr::vector<double> back_underlying_;
+    std::pmr::vector<double> back_call_;
+    std::pmr::vector<double> back_put_;
+    double back_ms_ = 0.0;
+
+    // Hand-off between request() and the worker, guarded by mutex_
+    std::mutex mutex_;
+    std::condition_variable_any wake_;
+    Grid job_{};
+    bool pending_ = false;
+    bool ready_ = false;
+    std::atomic<std::uint64_t> generation_{0};  ///< Bumped by every request; also read between chunks
+
+    std::jthread worker_;  // Last, so it stops before the state above is destroyed
+};
+
+} // namespace BlackScholes
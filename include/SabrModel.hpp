@@ -0,0 +1,178 @@
+#pragma once
+
+#include "LevenbergMarquardt.hpp"
+#include "WorkerPool.hpp"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+/**
+ * @file SabrModel.hpp
+ * @brief SABR stochastic-alpha-beta-rho model for forward-quoted markets
+ *
+ * Implied Black volatilities come from the Hagan et al. (2002) asymptotic
+ * expansion, optionally with Obloj's (2008) corrected leading term, and are
+ * priced through the Black-76 kernel. Calibration solves α from the ATM
+ * volatility and fits ρ and ν per expiry. The batch functions hoist the
+ * strike-independent terms and then run a scalar loop over the strikes;
+ * there is no SIMD path.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief SABR model parameters
+ */
+struct SabrParameters {
+    double alpha;  ///< Initial volatility level α (> 0)
+    double beta;   ///< CEV exponent β, in [0, 1]
+    double rho;    ///< Forward/volatility correlation, in (-1, 1)
+    double nu;     ///< Volatility of volatility ν (≥ 0)
+
+    /**
+     * @brief Validate all parameters
+     * @return true if all parameters are valid
+     */
+    [[nodiscard]] bool is_valid() const noexcept;
+};
+
+/**
+ * @brief Leading-order term used in the implied volatility expansion
+ */
+enum class SabrExpansion {
+    Hagan,  ///< Hagan et al. (2002) original formula
+    Obloj   ///< Obloj (2008) correction, exact in the β = 1 and ν = 0 limits
+};
+
+namespace Sabr {
+
+/**
+ * @brief Black implied volatility for one strike
+ * @param params SABR parameters
+ * @param forward Forward price F (> 0)
+ * @param strike Strike K (> 0)
+ * @param expiry Time to expiration T
+ * @param expansion Expansion variant
+ * @return Lognormal (Black-76) implied volatility
+ */
+[[nodiscard]] double implied_volatility(const SabrParameters& params, double forward, double strike,
+                                        double expiry, SabrExpansion expansion = SabrExpansion::Obloj) noexcept;
+
+/**
+ * @brief Black implied volatilities for every strike of one expiry
+ *
+ * Strike-independent terms are computed once for the whole slice; the
+ * strikes are then evaluated in a scalar loop.
+ *
+ * @param params SABR parameters
+ * @param forward Forward price F (> 0)
+ * @param expiry Time to expiration T (> 0)
+ * @param strikes Strikes (each > 0)
+ * @param volatilities Destination implied volatilities
+ * @param expansion Expansion variant
+ * @throws std::invalid_argument if inputs are invalid or spans mismatch
+ */
+void implied_volatility_batch(const SabrParameters& params, double forward, double expiry,
+                              std::span<const double> strikes, std::span<double> volatilities,
+                              SabrExpansion expansion = SabrExpansion::Obloj);
+
+/**
+ * @brief Price every strike of one expiry through the Black-76 kernel
+ * @param params SABR parameters
+ * @param forward Forward price F (> 0)
+ * @param expiry Time to expiration T (> 0)
+ * @param rate Discount rate r
+ * @param strikes Strikes (each > 0)
+ * @param calls Destination call prices
+ * @param puts Destination put prices
+ * @param expansion Expansion variant
+ * @throws std::invalid_argument if inputs are invalid or spans mismatch
+ */
+void price_batch(const SabrParameters& params, double forward, double expiry, double rate,
+                 std::span<const double> strikes, std::span<double> calls, std::span<double> puts,
+                 SabrExpansion expansion = SabrExpansion::Obloj);
+
+/**
+ * @brief Solve α so that the model reproduces an ATM volatility
+ *
+ * Inverts the cubic ATM limit of the expansion for its smallest positive root.
+ *
+ * @return α, or 0 if no positive root exists
+ */
+[[nodiscard]] double alpha_from_atm(double atm_volatility, double forward, double expiry,
+                                    double beta, double rho, double nu) noexcept;
+
+} // namespace Sabr
+
+/**
+ * @brief Market implied volatilities for one expiry
+ */
+struct SabrSlice {
+    double expiry;                     ///< Time to expiration T (> 0)
+    double forward;                    ///< Forward price F (> 0)
+    std::vector<double> strikes;       ///< Quoted strikes
+    std::vector<double> volatilities;  ///< Black implied volatility per strike
+    std::vector<double> weights;       ///< Optional fit weights (empty = uniform)
+};
+
+/**
+ * @brief Outcome of fitting one SABR slice
+ */
+struct SabrFitResult {
+    SabrParameters params;  ///< Fitted parameters
+    double rms_error;       ///< Root-mean-square volatility error
+    int iterations;         ///< Levenberg-Marquardt iterations used
+    bool converged;         ///< true if the tolerance or an exact fit was reached, false on a stall
+};
+
+/**
+ * @brief Stateful per-expiry SABR calibrator with fixed β
+ *
+ * α is eliminated by matching the ATM volatility exactly, leaving a
+ * two-parameter fit of ρ and ν. Repeated calibrations over the same expiries
+ * warm-start from the previous solution, which keeps per-tick recalibration
+ * to a handful of iterations. Not thread-safe itself; slice fits run on
+ * a WorkerPool started by the first calibrate() and parked in between.
+ * Per-call scratch is taken from the given memory resource on the calling
+ * thread only, so a ScratchArena may be passed; results are copied into
+ * storage the calibrator keeps between calls.
+ */
+class SabrCalibrator {
+public:
+    /**
+     * @brief Create a calibrator
+     * @param beta Fixed CEV exponent, in [0, 1]
+     * @param config Calibration settings
+     * @param expansion Expansion variant used for fitting
+     * @throws std::invalid_argument if beta is out of range
+     */
+    explicit SabrCalibrator(double beta, CalibrationConfig config = {},
+                            SabrExpansion expansion = SabrExpansion::Obloj);
+
+    /**
+     * @brief Fit every slice in parallel
+     * @param slices Market slices sorted by increasing expiry
+     * @param resource Memory resource for the per-slice fits and strike terms
+     * @return One result per slice
+     * @throws std::invalid_argument if a slice is malformed
+     */
+    const std::vector<SabrFitResult>& calibrate(std::span<const SabrSlice> slices,
+                                                std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Results of the last calibration
+     */
+    [[nodiscard]] const std::vector<SabrFitResult>& results() const noexcept { return results_; }
+
+private:
+    double beta_;
+    CalibrationConfig config_;
+    SabrExpansion expansion_;
+    std::vector<SabrFitResult> results_;
+    std::vector<double> expiries_;
+    std::unique_ptr<WorkerPool> workers_;  ///< Started by the first calibrate()
+};
+
+} // namespace BlackScholes
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "LevenbergMarquardt.hpp"
+#include "VolSurface.hpp"
+#include "WorkerPool.hpp"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+/**
+ * @file SviCalibration.hpp
+ * @brief SVI and SSVI volatility surface calibration
+ *
+ * Fits Gatheral's raw SVI parameterization to each expiry slice of implied
+ * volatilities, and the SSVI surface of Gatheral-Jacquier across slices.
+ * Both use Levenberg-Marquardt with analytic Jacobians. Slices are fitted in
+ * parallel and each calibration warm-starts from the previous one.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Market implied volatilities for one expiry
+ */
+struct SviSlice {
+    double expiry;                     ///< Time to expiration T (> 0)
+    double forward;                    ///< Forward price F used for log-moneyness ln(K/F)
+    std::vector<double> strikes;       ///< Quoted strikes
+    std::vector<double> volatilities;  ///< Implied volatility per strike
+    std::vector<double> weights;       ///< Optional fit weights (empty = uniform)
+};
+
+/**
+ * @brief Raw SVI slice: w(k) = a + b·(ρ(k - m) + √((k - m)² + σ²))
+ */
+struct SviParameters {
+    double a;      ///< Variance level
+    double b;      ///< Wing slope (≥ 0)
+    double rho;    ///< Skew, in (-1, 1)
+    double m;      ///< Horizontal shift
+    double sigma;  ///< ATM curvature (> 0)
+
+    /**
+     * @brief Total implied variance at log-moneyness k
+     */
+    [[nodiscard]] double total_variance(double k) const noexcept;
+};
+
+/**
+ * @brief SSVI surface with power-law φ(θ) = η / (θ^γ·(1 + θ)^(1-γ))
+ *
+ * w(k, θ_t) = θ_t/2 · (1 + ρφk + √((φk + ρ)² + 1 - ρ²)), where θ_t is the
+ * ATM total variance of each expiry. With η(1 + |ρ|) ≤ 2 and γ ≤ ½ this φ
+ * gives θφ(1 + |ρ|) < 2 and θφ²(1 + |ρ|) ≤ 4 for every θ, the
+ * Gatheral-Jacquier (2014) conditions for no butterfly arbitrage; θφ is
+ * increasing in θ, so non-decreasing θ_t also rules out calendar spreads.
+ * The plain law ηθ^(-γ) meets neither bound once θ grows large.
+ */
+struct SsviParameters {
+    double rho;                   ///< Global skew, in (-1, 1)
+    double eta;                   ///< Curvature level (> 0)
+    double gamma;                 ///< Curvature decay, in (0, ½]
+    std::vector<double> expiries; ///< Slice expiries
+    std::vector<double> forwards; ///< Slice forwards
+    std::vector<double> theta;    ///< ATM total variance per slice
+
+    /**
+     * @brief Curvature φ(θ_t) of a slice
+     */
+    [[nodiscard]] double curvature(double theta_t) const noexcept;
+
+    /**
+     * @brief Total implied variance at log-moneyness k on a slice
+     */
+    [[nodiscard]] double total_variance(double k, double theta_t) const noexcept;
+};
+
+/**
+ * @brief Outcome of fitting one SVI slice
+ */
+struct SviFitResult {
+    SviParameters params;  ///< Fitted parameters
+    double rms_error;      ///< Root-mean-square total variance error
+    int iterations;        ///< Levenberg-Marquardt iterations used
+    bool converged;        ///< true if the tolerance or an exact fit was reached, false on a stall
+};
+
+/**
+ * @brief Stateful SVI/SSVI calibrator
+ *
+ * Keeps the last fitted parameters so that repeated calibrations on slowly
+ * moving markets start from the previous solution. Not thread-safe itself;
+ * slice fits run on a WorkerPool started by the first calibrate() and
+ * parked in between. Per-call scratch is taken from the given memory
+ * resource on the calling thread only, so a ScratchArena may be passed;
+ * results are copied into storage the calibrator keeps between calls.
+ */
+class SviCalibrator {
+public:
+    /**
+     * @brief Create a calibrator
+     * @param config Calibration settings
+     */
+    explicit SviCalibrator(CalibrationConfig config = {}) : config_(config) {}
+
+    /**
+     * @brief Fit raw SVI to every slice in parallel
+     * @param slices Market slices sorted by increasing expiry
+     * @param resource Memory resource for the per-slice fits and their inputs
+     * @return One result per slice
+     * @throws std::invalid_argument if a slice is malformed
+     */
+    const std::vector<SviFitResult>& calibrate(std::span<const SviSlice> slices,
+                                               std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Fit the SSVI surface across slices
+     *
+     * ATM total variances come from a raw SVI fit of each slice, so this also
+     * refreshes the per-slice results.
+     *
+     * @param slices Market slices sorted by increasing expiry
+     * @param resource Memory resource for the slice fits and the pooled SSVI points
+     * @return Fitted SSVI surface
+     * @throws std::invalid_argument if a slice is malformed
+     */
+    const SsviParameters& calibrate_ssvi(std::span<const SviSlice> slices,
+                                         std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Sample the last raw SVI fits onto a volatility surface grid
+     * @param strikes Strictly increasing grid strikes
+     * @param method Interpolation across strikes
+     * @param resource Memory resource for the sampled volatility grid; the surface's own slices use the default heap
+     * @return Surface ready for VolSurface::lookup_batch
+     * @throws std::logic_error if calibrate() has not been run
+     */
+    [[nodiscard]] VolSurface svi_surface(std::vector<double> strikes,
+                                         VolInterpolation method = VolInterpolation::CubicSpline,
+                                         std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+    /**
+     * @brief Sample the last SSVI fit onto a volatility surface grid
+     * @param strikes Strictly increasing grid strikes
+     * @param method Interpolation across strikes
+     * @param resource Memory resource for the sampled volatility grid; the surface's own slices use the default heap
+     * @return Surface ready for VolSurface::lookup_batch
+     * @throws std::logic_error if calibrate_ssvi() has not been run
+     */
+    [[nodiscard]] VolSurface ssvi_surface(std::vector<double> strikes,
+                                          VolInterpolation method = VolInterpolation::CubicSpline,
+                                          std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+    /**
+     * @brief Results of the last raw SVI calibration
+     */
+    [[nodiscard]] const std::vector<SviFitResult>& results() const noexcept { return results_; }
+
+private:
+    CalibrationConfig config_;
+    std::vector<SviFitResult> results_;
+    std::vector<double> expiries_;
+    std::vector<double> forwards_;
+    SsviParameters ssvi_{};
+    bool has_ssvi_ = false;
+    std::unique_ptr<WorkerPool> workers_;  ///< Started by the first calibrate()
+
+    /**
+     * @brief Fit a single slice from a starting point
+     * @param k Scratch for the slice's log-moneyness, one per strike
+     * @param targets Scratch for the slice's total variances, one per strike
+     */
+    [[nodiscard]] SviFitResult fit_slice(const SviSlice& slice, const SviParameters& start,
+                                         std::span<double> k, std::span<double> targets) const;
+};
+
+} // namespace BlackScholes
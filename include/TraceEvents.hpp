@@ -0,0 +1,138 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/**
+ * @file TraceEvents.hpp
+ * @brief Scoped trace spans exported as Chrome trace-event JSON
+ *
+ * Spans are appended to per-thread buffers with no locks or atomic
+ * read-modify-writes on the recording path; a thread's buffer only grows
+ * by linking a new chunk. On flush every thread's completed spans are
+ * written as "complete" (ph = X) events, which open offline in
+ * chrome://tracing or the Perfetto UI. Each buffer is one track; a new
+ * thread takes over the buffer of an exited one, so there are only as many
+ * tracks as threads ever ran at the same time.
+ */
+
+namespace BlackScholes::Tracing {
+
+namespace Detail {
+inline std::atomic<bool> enabled_flag{false};
+} // namespace Detail
+
+/**
+ * @brief Check whether spans are being recorded
+ */
+[[nodiscard]] inline bool enabled() noexcept {
+    return Detail::enabled_flag.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Start or stop recording spans on all threads
+ */
+void set_enabled(bool enabled) noexcept;
+
+/**
+ * @brief Name the calling thread's track in the trace
+ * @param name String with static storage duration
+ */
+void set_thread_name(const char* name) noexcept;
+
+/**
+ * @brief Nanoseconds since the trace epoch (first use of the tracer)
+ */
+[[nodiscard]] std::int64_t now_ns() noexcept;
+
+/**
+ * @brief Append a completed span to the calling thread's buffer
+ * @param name Span name with static storage duration
+ * @param category Category with static storage duration
+ * @param start_ns Start from now_ns()
+ * @param end_ns End from now_ns()
+ * @param items Optional item count shown in the span's args (negative = none)
+ */
+void record_span(const char* name, const char* category,
+                 std::int64_t start_ns, std::int64_t end_ns, std::int64_t items = -1) noexcept;
+
+/**
+ * @brief Write every thread's spans recorded so far as Chrome trace JSON
+ * @param path Output file
+ * @throws std::runtime_error if the file cannot be written
+ */
+void write_chrome_trace(const std::string& path);
+
+/**
+ * @brief Number of spans dropped because a buffer hit its limit or its thread was exiting
+ */
+[[nodiscard]] std::uint64_t dropped_spans() noexcept;
+
+/**
+ * @brief Records the enclosing scope as a span when tracing is on
+ */
+class TraceSpan {
+public:
+    /**
+     * @brief Open a span
+     * @param name Span name with static storage duration (a string literal)
+     * @param category Category with static storage duration
+     * @param items Optional item count, e.g. rows in a chunk
+     */
+    explicit TraceSpan(const char* name, const char* category = "pricing", std::int64_t items = -1) noexcept
+        : name_(name), category_(category), items_(items), start_ns_(enabled() ? now_ns() : -1) {}
+
+    ~TraceSpan() {
+        if (start_ns_ >= 0) {
+            record_span(name_, category_, start_ns_, now_ns(), items_);
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    /**
+     * @brief Set the item count once it is known, e.g. after reading input
+     */
+    void set_items(std::int64_t items) noexcept { items_ = items; }
+
+private:
+    const char* name_;
+    const char* category_;
+    std::int64_t items_;
+    std::int64_t start_ns_;
+};
+
+/**
+ * @brief Enables tracing for its lifetime and writes the trace file on destruction
+ *
+ * Intended to live for the whole program in main(), so the trace is
+ * flushed on a normal exit. Worker threads must be joined first for their
+ * final spans to be included.
+ */
+class TraceSession {
+public:
+    /**
+     * @brief Start recording
+     * @param path Chrome trace JSON file written on destruction
+     */
+    explicit TraceSession(std::string path);
+
+    ~TraceSession();
+
+    TraceSession(const TraceSession&) = delete;
+    TraceSession& operator=(const TraceSession&) = delete;
+
+    /**
+     * @brief Write the spans recorded so far without ending the session
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void flush() const { write_chrome_trace(path_); }
+
+private:
+    std::string path_;
+};
+
+} // namespace BlackScholes::Tracing
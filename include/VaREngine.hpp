@@ -0,0 +1,193 @@
+#pragma once
+
+#include "BlackScholesModel.hpp"
+#include <cstddef>
+#include <istream>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @file VaREngine.hpp
+ * @brief Historical-simulation Value-at-Risk and Expected Shortfall
+ *
+ * Reprices an option book under replayed market scenarios streamed from a
+ * file, in parallel batches, and derives VaR and ES from the scenario PnL.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Option position held in the book
+ */
+struct Position {
+    std::size_t underlying;   ///< Index of the underlying in each scenario
+    OptionType type;          ///< Call or put
+    double quantity;          ///< Signed number of contracts
+    OptionParameters params;  ///< Current market parameters
+};
+
+/**
+ * @brief One historical market scenario
+ *
+ * Scenario files hold one scenario per line as comma-separated values:
+ * rate shift, volatility shift, then one spot log-return per underlying.
+ * Blank lines and lines starting with '#' are ignored.
+ *
+ * Allocator-aware, so a std::pmr::vector<Scenario> places every scenario's
+ * returns in the vector's memory resource.
+ */
+struct Scenario {
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    double rate_shift = 0.0;                ///< Absolute shift of r
+    double volatility_shift = 0.0;          ///< Absolute shift of σ
+    std::pmr::vector<double> spot_returns;  ///< Log-return of each underlying
+
+    Scenario() = default;
+    Scenario(const Scenario&) = default;
+    Scenario(Scenario&&) = default;
+    Scenario& operator=(const Scenario&) = default;
+    Scenario& operator=(Scenario&&) = default;
+
+    explicit Scenario(const allocator_type& alloc) : spot_returns(alloc) {}
+    Scenario(const Scenario& other, const allocator_type& alloc)
+        : rate_shift(other.rate_shift), volatility_shift(other.volatility_shift)
+        , spot_returns(other.spot_returns, alloc) {}
+    Scenario(Scenario&& other, const allocator_type& alloc)
+        : rate_shift(other.rate_shift), volatility_shift(other.volatility_shift)
+        , spot_returns(std::move(other.spot_returns), alloc) {}
+};
+
+/**
+ * @brief Streaming reader for scenario files
+ */
+class ScenarioReader {
+public:
+    /**
+     * @brief Read scenarios from a stream
+     * @param input Stream positioned at the first scenario
+     */
+    explicit ScenarioReader(std::istream& input) : input_(input) {}
+
+    /**
+     * @brief Read up to max_count scenarios, reusing the storage in batch
+     * @param batch Destination; the first N entries are overwritten in place
+     * @param max_count Maximum number of scenarios to read
+     * @return Number of scenarios read (0 at end of input)
+     * @throws std::runtime_error on a malformed line
+     */
+    std::size_t read_batch(std::pmr::vector<Scenario>& batch, std::size_t max_count);
+
+    /**
+     * @brief Count the scenarios left in a stream without consuming them
+     *
+     * Scans to the end of the input and seeks back, so only seekable
+     * streams such as files and string streams can be counted.
+     *
+     * @param input Stream positioned at the first scenario
+     * @return Number of scenario lines ahead, or std::nullopt if the stream cannot seek
+     * @throws std::runtime_error if the stream cannot be rewound after the scan
+     */
+    [[nodiscard]] static std::optional<std::size_t> count_remaining(std::istream& input);
+
+private:
+    std::istream& input_;
+    std::string line_;
+    std::size_t line_number_ = 0;
+};
+
+/**
+ * @brief VaR engine configuration
+ */
+struct VaRConfig {
+    double confidence = 0.99;      ///< VaR confidence level
+    double horizon_days = 1.0;     ///< Risk horizon, rolled off the time to expiration
+    std::size_t batch_size = 256;  ///< Scenarios read and repriced per batch
+    unsigned num_threads = 0;      ///< Worker threads (0 = hardware concurrency)
+};
+
+/**
+ * @brief Wall-clock time spent in each stage of a VaR run
+ */
+struct VaRTimings {
+    double read_ms = 0.0;     ///< Parsing scenario input
+    double reprice_ms = 0.0;  ///< Repricing the book under scenarios
+    double select_ms = 0.0;   ///< Quantile selection and tail averaging
+};
+
+/**
+ * @brief Result of a VaR run
+ */
+struct VaRResult {
+    double value_at_risk;       ///< Loss not exceeded with the configured confidence
+    double expected_shortfall;  ///< Mean loss in the tail beyond VaR
+    double base_value;          ///< Book value under current parameters
+    std::size_t scenarios;      ///< Number of scenarios evaluated
+    VaRTimings timings;         ///< Per-stage timing
+};
+
+/**
+ * @brief Full-revaluation historical-simulation VaR engine
+ *
+ * Scenario input is counted up front when it can seek, so only the
+ * ⌊(1-c)·n⌋ largest losses are retained, in a heap, and memory stays
+ * bounded by the tail rather than the scenario count. Input that cannot
+ * seek retains one PnL value per scenario. VaR and ES are then obtained
+ * with std::nth_element over what was kept.
+ */
+class VaREngine {
+public:
+    /**
+     * @brief Create an engine for a book
+     * @param book Positions to revalue
+     * @param config Engine configuration
+     * @throws std::invalid_argument if the book or configuration is invalid
+     */
+    VaREngine(std::vector<Position> book, VaRConfig config = {});
+
+    /**
+     * @brief Run the engine over scenarios read from a stream
+     *
+     * Worker threads are started once per run and fed one batch at a time.
+     * Scenario batches and the retained losses come from the given resource;
+     * a ScratchArena reset between runs keeps repeated runs off the heap
+     * apart from worker thread start-up.
+     *
+     * @param scenarios Scenario input in the ScenarioReader format
+     * @param resource Memory resource for per-run scratch
+     * @return VaR, ES and timings
+     * @throws std::runtime_error if the input is malformed or empty
+     */
+    [[nodiscard]] VaRResult run(std::istream& scenarios,
+                                std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+    /**
+     * @brief Run the engine over a scenario file
+     * @param path Path to the scenario file
+     * @param resource Memory resource for per-run scratch
+     * @return VaR, ES and timings
+     * @throws std::runtime_error if the file cannot be read
+     */
+    [[nodiscard]] VaRResult run_file(const std::string& path,
+                                     std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+private:
+    std::vector<Position> book_;
+    VaRConfig config_;
+    double base_value_ = 0.0;
+
+    /**
+     * @brief Value the book under a single scenario
+     */
+    [[nodiscard]] double scenario_value(const Scenario& scenario) const;
+
+    /**
+     * @brief Value a single position with explicit market inputs
+     */
+    [[nodiscard]] static double position_value(const Position& position,
+                                               double S, double T, double r, double sigma);
+};
+
+} // namespace BlackScholes
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "PricingKernel.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+/**
+ * @file VolSurface.hpp
+ * @brief Implied volatility surface on a strike × expiry grid
+ *
+ * Interpolates in total variance w = σ²T: across strikes either linearly or
+ * with a natural cubic spline, and linearly across expiries. Per-expiry
+ * slices, including spline coefficients, are built once at construction.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Interpolation scheme across strikes
+ */
+enum class VolInterpolation {
+    LinearVariance,  ///< Piecewise linear in total variance
+    CubicSpline      ///< Natural cubic spline in total variance
+};
+
+/**
+ * @brief Implied volatility surface
+ *
+ * Extrapolation is flat in volatility outside the strike range and outside
+ * the expiry range. Immutable after construction, so safe to share between
+ * threads.
+ */
+class VolSurface {
+public:
+    /**
+     * @brief Cached total-variance slice at a single expiry
+     */
+    struct Slice {
+        double expiry = 0.0;                     ///< Slice expiry T
+        std::vector<double> variance;            ///< Total variance σ²T at each grid strike
+        std::vector<double> second_derivative;   ///< Spline second derivatives (zero when linear)
+    };
+
+    /**
+     * @brief Build a surface from a volatility grid
+     * @param strikes Strictly increasing strikes (at least two)
+     * @param expiries Strictly increasing positive expiries (at least one)
+     * @param volatilities Row-major [expiry][strike] volatilities, all > 0
+     * @param method Interpolation across strikes
+     * @throws std::invalid_argument if the grid is malformed
+     */
+    VolSurface(std::vector<double> strikes,
+               std::vector<double> expiries,
+               std::span<const double> volatilities,
+               VolInterpolation method = VolInterpolation::LinearVariance);
+
+    /**
+     * @brief Interpolated volatility at a single point
+     * @param strike Strike K
+     * @param expiry Time to expiration T (must be > 0)
+     * @return Implied volatility σ(K, T)
+     */
+    [[nodiscard]] double volatility(double strike, double expiry) const noexcept;
+
+    /**
+     * @brief Interpolated volatilities for many contracts
+     *
+     * Consecutive contracts with the same expiry share one blended slice, and
+     * within such a run the strike cursor only moves forward while strikes
+     * are non-decreasing. Inputs sorted by (expiry, strike) are therefore
+     * resolved in a single streaming pass. Input must be grouped by expiry
+     * for that pass: every change of expiry blends a new slice at a cost of
+     * O(grid strikes), so interleaved expiries cost O(n · grid strikes).
+     * Strikes that step back within a run cost one binary search each.
+     *
+     * @param strikes Strike of each contract
+     * @param expiries Expiry of each contract (each > 0)
+     * @param out Destination volatilities
+     * @param resource Memory resource for the blended slice
+     * @throws std::invalid_argument if the spans have mismatched lengths
+     */
+    void lookup_batch(std::span<const double> strikes,
+                      std::span<const double> expiries,
+                      std::span<double> out,
+                      std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+    /**
+     * @brief Fill the volatility column for a pricing batch
+     * @param batch Batch whose strike and expiry columns are read
+     * @param out Destination, typically the storage behind batch.volatility
+     * @param resource Memory resource for the blended slice
+     * @throws std::invalid_argument if the spans have mismatched lengths
+     */
+    void lookup_batch(const OptionBatch& batch, std::span<double> out,
+                      std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const {
+        lookup_batch(batch.strike_price, batch.time_to_expiration, out, resource);
+    }
+
+    /**
+     * @brief Total-variance slice interpolated to an arbitrary expiry
+     * @param expiry Time to expiration T (must be > 0)
+     * @return Slice that can be reused for every contract with this expiry
+     */
+    [[nodiscard]] Slice slice_at(double expiry) const;
+
+    /**
+     * @brief Grid strikes
+     */
+    [[nodiscard]] const std::vector<double>& strikes() const noexcept { return strikes_; }
+
+    /**
+     * @brief Cached slices, one per grid expiry
+     */
+    [[nodiscard]] const std::vector<Slice>& slices() const noexcept { return slices_; }
+
+private:
+    std::vector<double> strikes_;
+    std::vector<Slice> slices_;
+    VolInterpolation method_;
+
+    /**
+     * @brief Blend the two grid slices bracketing expiry into per-strike columns
+     */
+    void blend_slice(double expiry, std::span<double> variance, std::span<double> second_derivative) const noexcept;
+
+    /**
+     * @brief Index of the strike segment containing K, clamped to the grid
+     */
+    [[nodiscard]] std::size_t find_segment(double strike) const noexcept;
+
+    /**
+     * @brief Evaluate total variance on a slice within a known segment
+     */
+    [[nodiscard]] double slice_variance(std::span<const double> variance,
+                                        std::span<const double> second_derivative,
+                                        std::size_t segment, double strike) const noexcept;
+
+    /**
+     * @brief Evaluate total variance on a cached slice within a known segment
+     */
+    [[nodiscard]] double slice_variance(const Slice& slice, std::size_t segment, double strike) const noexcept {
+        return slice_variance(slice.variance, slice.second_derivative, segment, strike);
+    }
+
+    /**
+     * @brief Natural cubic spline second derivatives through (strikes_, values)
+     */
+    [[nodiscard]] std::vector<double> spline_second_derivatives(const std::vector<double>& values) const;
+};
+
+} // namespace BlackScholes
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file WorkerPool.hpp
+ * @brief Fixed set of threads that run one parallel job at a time
+ *
+ * For engines that fan out over and over, such as per scenario batch or
+ * per frame: threads are started once and parked between jobs instead of
+ * being created and joined for every job.
+ */
+
+namespace BlackScholes {
+
+/**
+ * @brief Threads started once and handed one job at a time
+ *
+ * A job runs on every worker, the calling thread included, and run()
+ * returns when all of them have finished it. Workers decide what share of
+ * the work to take from their index, or pull items from a shared counter.
+ * Handing out a job does not allocate.
+ */
+class WorkerPool {
+public:
+    /**
+     * @brief Start the pool's threads
+     * @param workers Workers including the calling thread (0 = hardware concurrency)
+     * @param thread_name Trace track name of the pool threads, with static storage duration
+     */
+    explicit WorkerPool(unsigned workers = 0, const char* thread_name = "Worker");
+
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Number of workers, the calling thread included
+     */
+    [[nodiscard]] unsigned size() const noexcept { return static_cast<unsigned>(threads_.size()) + 1; }
+
+    /**
+     * @brief Call task(worker) once on every worker and wait for all of them
+     *
+     * The calling thread runs worker 0. One job at a time: run() must not be
+     * called concurrently or from inside a task.
+     *
+     * @param task Callable taking the worker index in [0, size())
+     * @throws The first exception thrown by a task, once every worker has finished
+     */
+    template <class Task>
+    void run(Task&& task) {
+        using Callable = std::remove_reference_t<Task>;
+        run_job([](void* context, unsigned worker) { (*static_cast<Callable*>(context))(worker); },
+                const_cast<void*>(static_cast<const void*>(std::addressof(task))));
+    }
+
+private:
+    using Job = void (*)(void* context, unsigned worker);
+
+    const char* thread_name_;
+    std::mutex mutex_;
+    std::condition_variable_any start_;
+    std::condition_variable done_;
+    Job job_ = nullptr;
+    void* context_ = nullptr;
+    std::uint64_t generation_ = 0;  ///< Incremented for every job
+    unsigned remaining_ = 0;        ///< Pool threads still running the current job
+    std::vector<std::exception_ptr> errors_;
+    std::vector<std::jthread> threads_;  // Last, so threads stop before the state they use goes
+
+    void run_job(Job job, void* context);
+    void work(std::stop_token stop, unsigned worker);
+};
+
+} // namespace BlackScholes
@@ -0,0 +1,393 @@
+#include "AccuracyHarness.hpp"
+#include "ConstexprMath.hpp"
+#include "IncrementalEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+
+namespace BlackScholes::Accuracy {
+
+namespace {
+
+constexpr std::array<OptionField, option_field_count> every_field{
+    OptionField::CallPrice, OptionField::PutPrice, OptionField::DeltaCall, OptionField::DeltaPut,
+    OptionField::Gamma, OptionField::ThetaCall, OptionField::ThetaPut, OptionField::Vega,
+    OptionField::RhoCall, OptionField::RhoPut
+};
+
+/**
+ * @brief Uniform double in [0, 1) from the top 53 bits of a 64-bit draw
+ *
+ * Used instead of std::uniform_real_distribution, whose output is not
+ * specified exactly, so a seed gives the same grid on every standard library.
+ */
+double unit_interval(std::mt19937_64& engine) noexcept {
+    return static_cast<double>(engine() >> 11) * 0x1.0p-53;
+}
+
+double log_uniform(std::mt19937_64& engine, double low, double high) noexcept {
+    return low * std::exp(std::log(high / low) * unit_interval(engine));
+}
+
+} // namespace
+
+template <class Variant>
+ReferencePrices reference_prices(double S, double K, double T, double r, double q, double sigma) noexcept {
+    const HighPrecision::ExtendedPrices prices = HighPrecision::price_extended<Variant>(S, K, T, r, q, sigma);
+    return ReferencePrices{
+        prices.call_price,
+        prices.put_price,
+        prices.delta_call,
+        prices.delta_put,
+        prices.gamma,
+        prices.theta_call,
+        prices.theta_put,
+        prices.vega,
+        prices.rho_call,
+        prices.rho_put
+    };
+}
+
+template ReferencePrices reference_prices<BlackScholesMerton>(double, double, double, double, double, double) noexcept;
+template ReferencePrices reference_prices<Black76>(double, double, double, double, double, double) noexcept;
+template ReferencePrices reference_prices<GarmanKohlhagen>(double, double, double, double, double, double) noexcept;
+
+// Grid implementation
+void Grid::add(double S, double K, double T, double r, double q, double sigma) {
+    underlying_price.push_back(S);
+    strike_price.push_back(K);
+    time_to_expiration.push_back(T);
+    risk_free_rate.push_back(r);
+    dividend_yield.push_back(q);
+    volatility.push_back(sigma);
+}
+
+OptionBatch Grid::batch() const noexcept {
+    return OptionBatch{
+        .underlying_price = underlying_price,
+        .strike_price = strike_price,
+        .time_to_expiration = time_to_expiration,
+        .risk_free_rate = risk_free_rate,
+        .dividend_yield = dividend_yield,
+        .volatility = volatility
+    };
+}
+
+Grid make_grid(std::size_t random_points, std::uint64_t seed) {
+    constexpr double spot = 100.0;
+    constexpr std::array<double, 12> strikes{0.01, 1.0, 25.0, 50.0, 80.0, 95.0, 100.0,
+                                             105.0, 125.0, 200.0, 400.0, 10000.0};
+    constexpr std::array<double, 6> expiries{1e-6, 1e-4, 1.0 / 365.25, 0.25, 1.0, 30.0};
+    constexpr std::array<double, 6> volatilities{0.001, 0.05, 0.3, 2.0, 5.0, 10.0};
+    constexpr std::array<std::array<double, 2>, 3> rates{{{-0.01, 0.0}, {0.05, 0.03}, {0.15, 0.0}}};
+
+    Grid grid;
+    const std::size_t edge_points = strikes.size() * expiries.size() * volatilities.size() * rates.size();
+    grid.underlying_price.reserve(random_points + edge_points);
+    grid.strike_price.reserve(random_points + edge_points);
+    grid.time_to_expiration.reserve(random_points + edge_points);
+    grid.risk_free_rate.reserve(random_points + edge_points);
+    grid.dividend_yield.reserve(random_points + edge_points);
+    grid.volatility.reserve(random_points + edge_points);
+
+    std::mt19937_64 engine(seed);
+    for (std::size_t i = 0; i < random_points; ++i) {
+        const double K = spot * log_uniform(engine, 0.2, 5.0);
+        const double T = log_uniform(engine, 1.0 / 365.25, 10.0);
+        const double sigma = log_uniform(engine, 0.02, 2.0);
+        const double r = -0.02 + 0.14 * unit_interval(engine);
+        const double q = 0.08 * unit_interval(engine);
+        grid.add(spot, K, T, r, q, sigma);
+    }
+
+    for (const double K : strikes) {
+        for (const double T : expiries) {
+            for (const double sigma : volatilities) {
+                for (const auto& [r, q] : rates) {
+                    grid.add(spot, K, T, r, q, sigma);
+                }
+            }
+        }
+    }
+    return grid;
+}
+
+// BackendReport and Report implementation
+std::size_t BackendReport::failures() const noexcept {
+    std::size_t total = 0;
+    for (const FieldError& error : errors) {
+        total += error.failures;
+    }
+    return total;
+}
+
+bool Report::passed() const noexcept {
+    return std::all_of(backends.begin(), backends.end(),
+                       [](const BackendReport& backend) { return backend.passed(); });
+}
+
+std::vector<Backend> default_backends() {
+    // The kernels' N(x) is good to about 1e-15 relative in both tails; what is
+    // left is rounding in d₁, d₂ and the cancelling difference of two terms,
+    // a few 1e-12 at the grid's largest discounted strike.
+    constexpr Tolerance kernel_tolerance{.absolute = 1e-10, .relative = 1e-12};
+    // Constexpr::value uses a series/continued-fraction erfc good to a few ulp
+    constexpr Tolerance constexpr_tolerance{.absolute = 1e-12, .relative = 1e-12};
+    // The double-double backend is the reference rounded to double: half an ulp, or
+    // less than the smallest normal double once a value underflows. Its arithmetic
+    // is checked against quad precision by precision_check, not here.
+    constexpr Tolerance rounding_tolerance{.absolute = 2.3e-308, .relative = 0x1.0p-53};
+
+    std::vector<Backend> backends;
+    backends.push_back(Backend{
+        .name = "Kernel::price_batch<BlackScholesMerton>",
+        .evaluate = [](const OptionBatch& batch, std::span<OptionPrices> out) {
+            Kernel::price_batch<BlackScholesMerton>(batch, out);
+        },
+        .reference = &reference_prices<BlackScholesMerton>,
+        .fields = all_fields,
+        .tolerance = kernel_tolerance
+    });
+    backends.push_back(Backend{
+        .name = "Kernel::price_batch<Black76>",
+        .evaluate = [](const OptionBatch& batch, std::span<OptionPrices> out) {
+            Kernel::price_batch<Black76>(batch, out);
+        },
+        .reference = &reference_prices<Black76>,
+        .fields = all_fields,
+        .tolerance = kernel_tolerance
+    });
+    backends.push_back(Backend{
+        .name = "Kernel::price_batch<GarmanKohlhagen>",
+        .evaluate = [](const OptionBatch& batch, std::span<OptionPrices> out) {
+            Kernel::price_batch<GarmanKohlhagen>(batch, out);
+        },
+        .reference = &reference_prices<GarmanKohlhagen>,
+        .fields = all_fields,
+        .tolerance = kernel_tolerance
+    });
+    backends.push_back(Backend{
+        .name = "Kernel::value_batch<BlackScholesMerton>",
+        .evaluate = [](const OptionBatch& batch, std::span<OptionPrices> out) {
+            std::vector<double> call(batch.size());
+            std::vector<double> put(batch.size());
+            Kernel::value_batch<BlackScholesMerton>(batch, call, put);
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                out[i].call_price = call[i];
+                out[i].put_price = put[i];
+            }
+        },
+        .reference = &reference_prices<BlackScholesMerton>,
+        .fields = price_fields,
+        .tolerance = kernel_tolerance
+    });
+    backends.push_back(Backend{
+        .name = "Model::calculate_prices",
+        .evaluate = [](const OptionBatch& batch, std::span<OptionPrices> out) {
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                out[i] = Model::calculate_prices(OptionParameters(
+                    batch.underlying_price[i], batch.strike_price[i], batch.time_to_expiration[i],
+                    batch.risk_free_rate[i], batch.volatility[i], batch.dividend_yield[i]));
+            }
+        },
+        .reference = &reference_prices<BlackScholesMerton>,
+        .fields = all_fields,
+        .tolerance = kernel_tolerance
+    });
+    backends.push_back(Backend{
+        .name = "Model::call_price/put_price",
+        .evaluate = [](const OptionBatch& batch, std::span<OptionPrices> out) {
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                const OptionParameters params(
+                    batch.underlying_price[i], batch.strike_price[i], batch.time_to_expiration[i],
+                    batch.risk_free_rate[i], batch.volatility[i], batch.dividend_yield[i]);
+                out[i].call_price = Model::call_price(params);
+                out[i].put_price = Model::put_price(params);
+            }
+        },
+        .reference = &reference_prices<BlackScholesMerton>,
+        .fields = price_fields,
+        .tolerance = kernel_tolerance
+    });
+    backends.push_back(Backend{
+        .name = "IncrementalEngine",
+        .evaluate = [](const OptionBatch& batch, std::span<OptionPrices> out) {
+            // Each row is added at half its spot and moved back by a spot tick, so the
+            // values read are the ones repriced from the cached S-independent terms
+            IncrementalEngine engine;
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                engine.add_position(std::to_string(i), "audit", OptionParameters(
+                    0.5 * batch.underlying_price[i], batch.strike_price[i], batch.time_to_expiration[i],
+                    batch.risk_free_rate[i], batch.volatility[i], batch.dividend_yield[i]));
+            }
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                engine.update_spot(std::to_string(i), batch.underlying_price[i]);
+                out[i] = engine.prices(i);
+            }
+        },
+        .reference = &reference_prices<BlackScholesMerton>,
+        .fields = all_fields,
+        .tolerance = kernel_tolerance
+    });
+    backends.push_back(Backend{
+        .name = "Constexpr::value<BlackScholesMerton>",
+        .evaluate = [](const OptionBatch& batch, std::span<OptionPrices> out) {
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                const Kernel::OptionValues v = Constexpr::value<BlackScholesMerton>(
+                    batch.underlying_price[i], batch.strike_price[i], batch.time_to_expiration[i],
+                    batch.risk_free_rate[i], batch.dividend_yield[i], batch.volatility[i]);
+                out[i].call_price = v.call_price;
+                out[i].put_price = v.put_price;
+            }
+        },
+        .reference = &reference_prices<BlackScholesMerton>,
+        .fields = price_fields,
+        .tolerance = constexpr_tolerance
+    });
+    backends.push_back(Backend{
+        .name = "Kernel::price_batch<BlackScholesMerton> (DoubleDouble)",
+        .evaluate = [](const OptionBatch& batch, std::span<OptionPrices> out) {
+            Kernel::price_batch<BlackScholesMerton>(batch, out, Precision::DoubleDouble);
+        },
+        .reference = &reference_prices<BlackScholesMerton>,
+        .fields = all_fields,
+        .tolerance = rounding_tolerance
+    });
+    return backends;
+}
+
+Report run(const Grid& grid, const std::vector<Backend>& backends) {
+    const std::size_t n = grid.size();
+    const OptionBatch batch = grid.batch();
+
+    Report report;
+    report.rows = n;
+    report.backends.reserve(backends.size());
+
+    std::vector<OptionPrices> results(n);
+    for (const Backend& backend : backends) {
+        if (!backend.evaluate || backend.reference == nullptr) {
+            throw std::invalid_argument("Accuracy backend " + backend.name + " is incomplete");
+        }
+
+        std::fill(results.begin(), results.end(), OptionPrices{});
+        backend.evaluate(batch, results);
+
+        BackendReport entry{.name = backend.name, .fields = backend.fields, .tolerance = backend.tolerance};
+        std::array<double, option_field_count> abs_sum{};
+        std::array<double, option_field_count> rel_sum{};
+        std::array<std::size_t, option_field_count> rel_count{};
+        std::array<double, option_field_count> worst_excess{};
+        worst_excess.fill(-1.0);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const ReferencePrices reference = backend.reference(
+                grid.underlying_price[i], grid.strike_price[i], grid.time_to_expiration[i],
+                grid.risk_free_rate[i], grid.dividend_yield[i], grid.volatility[i]);
+
+            for (const OptionField field : every_field) {
+                const auto f = static_cast<std::size_t>(field);
+                if (!backend.fields[f]) {
+                    continue;
+                }
+
+                // The difference is formed in double-double, so it is exact to well below double rounding
+                const double expected = reference[f].hi;
+                const double diff = (reference[f] - option_field_value(results[i], field)).hi;
+                // NaN from the backend counts as an infinite error
+                const double abs_error = std::isnan(diff) ? HUGE_VAL : std::abs(diff);
+                const double rel_error = expected != 0.0
+                    ? abs_error / std::abs(expected)
+                    : (abs_error == 0.0 ? 0.0 : HUGE_VAL);
+
+                FieldError& error = entry.errors[f];
+                error.max_abs_error = std::max(error.max_abs_error, abs_error);
+                abs_sum[f] += abs_error;
+                if (expected != 0.0) {
+                    error.max_rel_error = std::max(error.max_rel_error, rel_error);
+                    rel_sum[f] += rel_error;
+                    ++rel_count[f];
+                }
+
+                // How far past the looser of the two bounds; above 1 fails
+                const double excess = std::min(abs_error / backend.tolerance.absolute,
+                                               rel_error / backend.tolerance.relative);
+                if (excess > 1.0) {
+                    ++error.failures;
+                }
+                if (excess > worst_excess[f]) {
+                    worst_excess[f] = excess;
+                    error.worst_row = i;
+                }
+            }
+        }
+
+        for (std::size_t f = 0; f < option_field_count; ++f) {
+            if (n > 0) {
+                entry.errors[f].mean_abs_error = abs_sum[f] / static_cast<double>(n);
+            }
+            if (rel_count[f] > 0) {
+                entry.errors[f].mean_rel_error = rel_sum[f] / static_cast<double>(rel_count[f]);
+            }
+        }
+        report.backends.push_back(std::move(entry));
+    }
+    return report;
+}
+
+void write_report(std::ostream& out, const Report& report, const Grid& grid) {
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+
+    out << "Accuracy audit over " << report.rows << " contracts against a double-double reference\n";
+
+    for (const BackendReport& backend : report.backends) {
+        out << '\n' << backend.name << ": " << (backend.passed() ? "PASS" : "FAIL")
+            << std::scientific << std::setprecision(1)
+            << " (tolerance abs " << backend.tolerance.absolute << ", rel " << backend.tolerance.relative;
+        if (!backend.passed()) {
+            out << ", " << backend.failures() << " values outside";
+        }
+        out << ")\n";
+        out << "  " << std::left << std::setw(12) << "field" << std::right
+            << std::setw(11) << "max abs" << std::setw(11) << "mean abs"
+            << std::setw(11) << "max rel" << std::setw(11) << "mean rel"
+            << std::setw(10) << "failures" << '\n';
+
+        for (const OptionField field : every_field) {
+            const auto f = static_cast<std::size_t>(field);
+            if (!backend.fields[f]) {
+                continue;
+            }
+            const FieldError& error = backend.errors[f];
+            out << "  " << std::left << std::setw(12) << option_field_name(field) << std::right
+                << std::setw(11) << error.max_abs_error << std::setw(11) << error.mean_abs_error
+                << std::setw(11) << error.max_rel_error << std::setw(11) << error.mean_rel_error
+                << std::setw(10) << error.failures << '\n';
+        }
+
+        for (const OptionField field : every_field) {
+            const auto f = static_cast<std::size_t>(field);
+            const FieldError& error = backend.errors[f];
+            if (!backend.fields[f] || error.failures == 0 || error.worst_row >= grid.size()) {
+                continue;
+            }
+            const std::size_t i = error.worst_row;
+            out << std::defaultfloat << std::setprecision(6)
+                << "  worst " << option_field_name(field) << " at row " << i
+                << ": S=" << grid.underlying_price[i] << " K=" << grid.strike_price[i]
+                << " T=" << grid.time_to_expiration[i] << " r=" << grid.risk_free_rate[i]
+                << " q=" << grid.dividend_yield[i] << " sigma=" << grid.volatility[i] << '\n'
+                << std::scientific << std::setprecision(1);
+        }
+    }
+
+    out << '\n' << (report.passed() ? "All backends within tolerance" : "Accuracy regression detected") << '\n';
+    out.flags(flags);
+    out.precision(precision);
+}
+
+} // namespace BlackScholes::Accuracy
@@ -0,0 +1,144 @@
+#include "BachelierModel.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+namespace {
+
+/**
+ * @brief Inverse of the normalized time value Φ(x) + φ(x)/x for x < 0
+ * @param target Normalized time value φ̄* in (-∞, 0)
+ */
+inline double inverse_normalized_time_value(double target) noexcept {
+    constexpr double inv_sqrt_2pi = 0.3989422804014327;
+
+    // Jäckel's two-branch rational guess
+    double x;
+    if (target < -0.001882039271) {
+        const double g = 1.0 / (target - 0.5);
+        const double g2 = g * g;
+        const double xi = (0.032114372355 - g2 * (0.016969777977 - g2 * (2.6207332461e-3 - 9.6066952861e-5 * g2)))
+                        / (1.0 - g2 * (0.6635646938 - g2 * (0.14528712196 - 0.010472855461 * g2)));
+        x = g * (inv_sqrt_2pi + xi * g2);
+    } else {
+        const double h = std::sqrt(-std::log(-target));
+        x = (9.4883409779 - h * (9.6320903635 - h * (0.58556997323 + 2.1464093351 * h)))
+          / (1.0 - h * (0.65174820867 + h * (1.5120247828 + 6.6437847132e-5 * h)));
+    }
+
+    // Third-order Householder correction
+    const double phi_x = Kernel::normal_pdf(x);
+    const double q = (Kernel::normal_cdf(x) + phi_x / x - target) / phi_x;
+    const double x2 = x * x;
+    return x + 3.0 * q * x2 * (2.0 - q * x * (2.0 + x2))
+             / (6.0 + q * x * (-12.0 + x * (6.0 * q + x * (-6.0 + q * x * (3.0 + x2)))));
+}
+
+} // namespace
+
+bool NormalOptionParameters::is_valid() const noexcept {
+    return time_to_expiration > 0.0
+        && volatility > 0.0
+        && std::isfinite(forward)
+        && std::isfinite(strike_price)
+        && std::isfinite(time_to_expiration)
+        && std::isfinite(risk_free_rate)
+        && std::isfinite(volatility);
+}
+
+namespace Bachelier {
+
+OptionPrices calculate_prices(const NormalOptionParameters& params) {
+    if (!params.is_valid()) {
+        throw std::invalid_argument("Invalid parameters for Bachelier calculation");
+    }
+    return price(params.forward, params.strike_price, params.time_to_expiration,
+                 params.risk_free_rate, params.volatility);
+}
+
+void price_batch(const OptionBatch& batch, std::span<OptionPrices> out) {
+    if (!batch.is_consistent() || out.size() != batch.size()) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+
+    const std::size_t n = batch.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = price(batch.underlying_price[i], batch.strike_price[i], batch.time_to_expiration[i],
+                       batch.risk_free_rate[i], batch.volatility[i]);
+    }
+}
+
+void value_batch(const OptionBatch& batch, std::span<double> calls, std::span<double> puts) {
+    if (!batch.is_consistent() || calls.size() != batch.size() || puts.size() != batch.size()) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+
+    const std::size_t n = batch.size();
+    const double* F = batch.underlying_price.data();
+    const double* K = batch.strike_price.data();
+    const double* T = batch.time_to_expiration.data();
+    const double* r = batch.risk_free_rate.data();
+    const double* sigma = batch.volatility.data();
+    double* call_out = calls.data();
+    double* put_out = puts.data();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const Kernel::OptionValues v = value(F[i], K[i], T[i], r[i], sigma[i]);
+        call_out[i] = v.call_price;
+        put_out[i] = v.put_price;
+    }
+}
+
+double implied_volatility(double price, double F, double K, double T, double r, OptionType type) noexcept {
+    const double theta = type == OptionType::Call ? 1.0 : -1.0;
+    const double undiscounted = price * std::exp(r * T);
+    const double sqrt_T = std::sqrt(T);
+
+    const double intrinsic = std::max(theta * (F - K), 0.0);
+    double time_value = undiscounted - intrinsic;
+
+    // A price at intrinsic value can land a few ulp below it once undiscounted
+    if (time_value < 0.0 && time_value >= -4.0 * std::numeric_limits<double>::epsilon() * intrinsic) {
+        time_value = 0.0;
+    }
+    if (time_value < 0.0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (time_value == 0.0) {
+        return 0.0;
+    }
+
+    // At the money the price is linear in σ: V = σ√T/√(2π)
+    if (F == K) {
+        return time_value * 2.5066282746310002 / sqrt_T; // √(2π)
+    }
+
+    const double distance = std::abs(F - K);
+
+    const double x = inverse_normalized_time_value(-time_value / distance);
+    return distance / (std::abs(x) * sqrt_T);
+}
+
+void implied_volatility_batch(OptionType type,
+                              std::span<const double> prices,
+                              std::span<const double> forwards,
+                              std::span<const double> strikes,
+                              std::span<const double> expiries,
+                              std::span<const double> rates,
+                              std::span<double> volatilities) {
+    const std::size_t n = prices.size();
+    if (forwards.size() != n || strikes.size() != n || expiries.size() != n
+        || rates.size() != n || volatilities.size() != n) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        volatilities[i] = implied_volatility(prices[i], forwards[i], strikes[i], expiries[i], rates[i], type);
+    }
+}
+
+} // namespace Bachelier
+
+} // namespace BlackScholes
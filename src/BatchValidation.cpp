@@ -0,0 +1,113 @@
+#include "BatchValidation.hpp"
+#include "Instrumentation.hpp"
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+namespace {
+
+constexpr std::uint32_t bit(ValidationReason reason) noexcept {
+    return static_cast<std::uint32_t>(reason);
+}
+
+/**
+ * @brief Reason code for one row, computed with selects rather than branches
+ *
+ * x - x is 0 for finite x and NaN for ±∞ or NaN, so a sum of such terms tests
+ * several columns for finiteness at once.
+ */
+inline std::uint8_t row_reasons(double S, double K, double T, double r, double q, double sigma) noexcept {
+    const double finite_inputs = (S - S) + (K - K) + (T - T) + (sigma - sigma);
+    const std::uint32_t code = (S > 0.0 ? 0u : bit(ValidationReason::NonPositiveUnderlying))
+                             | (K > 0.0 ? 0u : bit(ValidationReason::NonPositiveStrike))
+                             | (T > 0.0 ? 0u : bit(ValidationReason::NonPositiveExpiry))
+                             | (sigma > 0.0 ? 0u : bit(ValidationReason::NonPositiveVolatility))
+                             | (r - r == 0.0 ? 0u : bit(ValidationReason::NonFiniteRate))
+                             | (q - q == 0.0 ? 0u : bit(ValidationReason::NonFiniteYield))
+                             | (finite_inputs == 0.0 ? 0u : bit(ValidationReason::NonFiniteInput));
+    return static_cast<std::uint8_t>(code);
+}
+
+} // namespace
+
+std::string_view describe(ValidationReason reason) noexcept {
+    switch (reason) {
+        case ValidationReason::None: return "valid";
+        case ValidationReason::NonPositiveUnderlying: return "underlying price must be positive";
+        case ValidationReason::NonPositiveStrike: return "strike price must be positive";
+        case ValidationReason::NonPositiveExpiry: return "time to expiration must be positive";
+        case ValidationReason::NonPositiveVolatility: return "volatility must be positive";
+        case ValidationReason::NonFiniteRate: return "risk-free rate must be finite";
+        case ValidationReason::NonFiniteYield: return "dividend yield must be finite";
+        case ValidationReason::NonFiniteInput: return "inputs must be finite";
+    }
+    return "unknown";
+}
+
+std::size_t validate_batch(const OptionBatch& batch,
+                           std::span<std::uint64_t> valid_mask,
+                           std::span<std::uint8_t> reasons) {
+    const std::size_t n = batch.size();
+    if (!batch.is_consistent() || reasons.size() != n || valid_mask.size() < mask_words(n)) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::BatchValidation, n);
+
+    const double* S = batch.underlying_price.data();
+    const double* K = batch.strike_price.data();
+    const double* T = batch.time_to_expiration.data();
+    const double* r = batch.risk_free_rate.data();
+    const double* q = batch.dividend_yield.data();
+    const double* sigma = batch.volatility.data();
+    std::uint8_t* codes = reasons.data();
+
+    // Reason codes first in one flat, vectorizable pass
+    for (std::size_t i = 0; i < n; ++i) {
+        codes[i] = row_reasons(S[i], K[i], T[i], r[i], q[i], sigma[i]);
+    }
+
+    // Then pack 64 rows per mask word
+    std::size_t valid_count = 0;
+    for (std::size_t word = 0; word < mask_words(n); ++word) {
+        const std::size_t begin = word * 64;
+        const std::size_t end = std::min(begin + 64, n);
+        std::uint64_t bits = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            bits |= static_cast<std::uint64_t>(codes[i] == 0) << (i - begin);
+        }
+        valid_mask[word] = bits;
+        valid_count += static_cast<std::size_t>(std::popcount(bits));
+    }
+    return valid_count;
+}
+
+ValidationReport validate_batch(const OptionBatch& batch, std::pmr::memory_resource* resource) {
+    if (!batch.is_consistent()) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+
+    ValidationReport report{
+        .valid_mask = std::pmr::vector<std::uint64_t>(mask_words(batch.size()), resource),
+        .reasons = std::pmr::vector<std::uint8_t>(batch.size(), resource)
+    };
+    report.valid_count = validate_batch(batch, report.valid_mask, report.reasons);
+    return report;
+}
+
+void mask_invalid(std::span<const std::uint64_t> valid_mask, std::span<double> values) {
+    const std::size_t n = values.size();
+    if (valid_mask.size() < mask_words(n)) {
+        throw std::invalid_argument("Validation mask is shorter than the values");
+    }
+
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t i = 0; i < n; ++i) {
+        const bool valid = (valid_mask[i / 64] >> (i % 64)) & 1u;
+        values[i] = valid ? values[i] : nan;
+    }
+}
+
+} // namespace BlackScholes
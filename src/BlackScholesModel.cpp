@@ -1,4 +1,7 @@
 #include "BlackScholesModel.hpp"
+#include "PricingKernel.hpp"
+#include "DoubleDouble.hpp"
+#include "Instrumentation.hpp"
 #include <stdexcept>
 #include <algorithm>
 #include <numbers>
@@ -6,85 +9,121 @@
 namespace BlackScholes {
 
 // OptionParameters implementation
-OptionParameters::OptionParameters(double S, double K, double T, double r, double sigma)
+OptionParameters::OptionParameters(double S, double K, double T, double r, double sigma, double q)
     : underlying_price(S)
     , strike_price(K)
     , time_to_expiration(T)
     , risk_free_rate(r)
     , volatility(sigma)
+    , dividend_yield(q)
 {
     if (!is_valid()) {
         throw std::invalid_argument("Invalid option parameters provided");
     }
 }
 
+OptionParameters::OptionParameters(Unchecked, double S, double K, double T, double r, double sigma, double q) noexcept
+    : underlying_price(S)
+    , strike_price(K)
+    , time_to_expiration(T)
+    , risk_free_rate(r)
+    , volatility(sigma)
+    , dividend_yield(q)
+{
+}
+
+OptionParameters OptionParameters::trusted(double S, double K, double T, double r, double sigma, double q) noexcept {
+    return OptionParameters(Unchecked{}, S, K, T, r, sigma, q);
+}
+
 bool OptionParameters::is_valid() const noexcept {
     return underlying_price > 0.0 
         && strike_price > 0.0 
         && time_to_expiration > 0.0 
         && volatility > 0.0
         && std::isfinite(risk_free_rate)
+        && std::isfinite(dividend_yield)
         && std::isfinite(underlying_price)
         && std::isfinite(strike_price)
         && std::isfinite(time_to_expiration)
         && std::isfinite(volatility);
 }
 
+// OptionField helpers
+std::string_view option_field_name(OptionField field) noexcept {
+    switch (field) {
+        case OptionField::CallPrice: return "call_price";
+        case OptionField::PutPrice: return "put_price";
+        case OptionField::DeltaCall: return "delta_call";
+        case OptionField::DeltaPut: return "delta_put";
+        case OptionField::Gamma: return "gamma";
+        case OptionField::ThetaCall: return "theta_call";
+        case OptionField::ThetaPut: return "theta_put";
+        case OptionField::Vega: return "vega";
+        case OptionField::RhoCall: return "rho_call";
+        case OptionField::RhoPut: return "rho_put";
+        case OptionField::Count: break;
+    }
+    return "unknown";
+}
+
+const char* option_field_label(OptionField field) noexcept {
+    switch (field) {
+        case OptionField::CallPrice: return "Call Price";
+        case OptionField::PutPrice: return "Put Price";
+        case OptionField::DeltaCall: return "Delta (call)";
+        case OptionField::DeltaPut: return "Delta (put)";
+        case OptionField::Gamma: return "Gamma";
+        case OptionField::ThetaCall: return "Theta (call)";
+        case OptionField::ThetaPut: return "Theta (put)";
+        case OptionField::Vega: return "Vega";
+        case OptionField::RhoCall: return "Rho (call)";
+        case OptionField::RhoPut: return "Rho (put)";
+        case OptionField::Count: break;
+    }
+    return "Unknown";
+}
+
+double option_field_value(const OptionPrices& prices, OptionField field) noexcept {
+    switch (field) {
+        case OptionField::CallPrice: return prices.call_price;
+        case OptionField::PutPrice: return prices.put_price;
+        case OptionField::DeltaCall: return prices.delta_call;
+        case OptionField::DeltaPut: return prices.delta_put;
+        case OptionField::Gamma: return prices.gamma;
+        case OptionField::ThetaCall: return prices.theta_call;
+        case OptionField::ThetaPut: return prices.theta_put;
+        case OptionField::Vega: return prices.vega;
+        case OptionField::RhoCall: return prices.rho_call;
+        case OptionField::RhoPut: return prices.rho_put;
+        case OptionField::Count: break;
+    }
+    return 0.0;
+}
+
 // Model implementation
 OptionPrices Model::calculate_prices(const OptionParameters& params) {
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::CalculatePrices);
     if (!params.is_valid()) {
         throw std::invalid_argument("Invalid parameters for Black-Scholes calculation");
     }
     
-    const double S = params.underlying_price;
-    const double K = params.strike_price;
-    const double T = params.time_to_expiration;
-    const double r = params.risk_free_rate;
-    const double sigma = params.volatility;
-    
-    // Calculate d1 and d2
-    const double d1 = calculate_d1(S, K, T, r, sigma);
-    const double d2 = calculate_d2(d1, sigma, T);
-    
-    // Calculate standard normal CDF and PDF values
-    const double N_d1 = normal_cdf(d1);
-    const double N_d2 = normal_cdf(d2);
-    const double N_neg_d1 = normal_cdf(-d1);
-    const double N_neg_d2 = normal_cdf(-d2);
-    const double phi_d1 = normal_pdf(d1);
-    
-    // Discount factors
-    const double discount_factor = std::exp(-r * T);
-    const double sqrt_T = std::sqrt(T);
-    
-    // Calculate option prices
-    const double call = S * N_d1 - K * discount_factor * N_d2;
-    const double put = K * discount_factor * N_neg_d2 - S * N_neg_d1;
+    return calculate_prices_trusted(params);
+}
+
+OptionPrices Model::calculate_prices(const OptionParameters& params, Precision precision) {
+    if (precision != Precision::DoubleDouble) {
+        return calculate_prices(params);
+    }
     
-    // Calculate Greeks
-    const double delta_call_val = N_d1;
-    const double delta_put_val = N_d1 - 1.0;
-    const double gamma_val = phi_d1 / (S * sigma * sqrt_T);
-    const double theta_call_val = -(S * phi_d1 * sigma) / (2.0 * sqrt_T) 
-                                  - r * K * discount_factor * N_d2;
-    const double theta_put_val = -(S * phi_d1 * sigma) / (2.0 * sqrt_T) 
-                                 + r * K * discount_factor * N_neg_d2;
-    const double vega_val = S * phi_d1 * sqrt_T;
-    const double rho_call_val = K * T * discount_factor * N_d2;
-    const double rho_put_val = -K * T * discount_factor * N_neg_d2;
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::CalculatePrices);
+    if (!params.is_valid()) {
+        throw std::invalid_argument("Invalid parameters for Black-Scholes calculation");
+    }
     
-    return OptionPrices{
-        .call_price = call,
-        .put_price = put,
-        .delta_call = delta_call_val,
-        .delta_put = delta_put_val,
-        .gamma = gamma_val,
-        .theta_call = theta_call_val / 365.25, // Convert to per day
-        .theta_put = theta_put_val / 365.25,   // Convert to per day
-        .vega = vega_val / 100.0,              // Convert to per 1% volatility change
-        .rho_call = rho_call_val / 100.0,      // Convert to per 1% rate change
-        .rho_put = rho_put_val / 100.0         // Convert to per 1% rate change
-    };
+    return HighPrecision::price<BlackScholesMerton>(params.underlying_price, params.strike_price,
+                                                    params.time_to_expiration, params.risk_free_rate,
+                                                    params.dividend_yield, params.volatility);
 }
 
 double Model::call_price(const OptionParameters& params) {
@@ -92,16 +131,7 @@ double Model::call_price(const OptionParameters& params) {
         throw std::invalid_argument("Invalid parameters for Black-Scholes calculation");
     }
     
-    const double d1 = calculate_d1(params.underlying_price, params.strike_price, 
-                                  params.time_to_expiration, params.risk_free_rate, 
-                                  params.volatility);
-    const double d2 = calculate_d2(d1, params.volatility, params.time_to_expiration);
-    
-    const double N_d1 = normal_cdf(d1);
-    const double N_d2 = normal_cdf(d2);
-    const double discount_factor = std::exp(-params.risk_free_rate * params.time_to_expiration);
-    
-    return params.underlying_price * N_d1 - params.strike_price * discount_factor * N_d2;
+    return call_price_trusted(params);
 }
 
 double Model::put_price(const OptionParameters& params) {
@@ -109,59 +139,93 @@ double Model::put_price(const OptionParameters& params) {
         throw std::invalid_argument("Invalid parameters for Black-Scholes calculation");
     }
     
-    const double d1 = calculate_d1(params.underlying_price, params.strike_price, 
-                                  params.time_to_expiration, params.risk_free_rate, 
-                                  params.volatility);
-    const double d2 = calculate_d2(d1, params.volatility, params.time_to_expiration);
-    
-    const double N_neg_d1 = normal_cdf(-d1);
-    const double N_neg_d2 = normal_cdf(-d2);
-    const double discount_factor = std::exp(-params.risk_free_rate * params.time_to_expiration);
-    
-    return params.strike_price * discount_factor * N_neg_d2 - params.underlying_price * N_neg_d1;
+    return put_price_trusted(params);
 }
 
-std::vector<std::tuple<double, double, double>> 
-Model::generate_price_curve(const OptionParameters& base_params, 
-                           double price_range, 
-                           int num_points) {
+OptionPrices Model::calculate_prices_trusted(const OptionParameters& params) noexcept {
+    return Kernel::price<BlackScholesMerton>(params.underlying_price, params.strike_price,
+                                             params.time_to_expiration, params.risk_free_rate,
+                                             params.dividend_yield, params.volatility);
+}
+
+double Model::call_price_trusted(const OptionParameters& params) noexcept {
+    return Kernel::value<BlackScholesMerton>(params.underlying_price, params.strike_price,
+                                             params.time_to_expiration, params.risk_free_rate,
+                                             params.dividend_yield, params.volatility).call_price;
+}
+
+double Model::put_price_trusted(const OptionParameters& params) noexcept {
+    return Kernel::value<BlackScholesMerton>(params.underlying_price, params.strike_price,
+                                             params.time_to_expiration, params.risk_free_rate,
+                                             params.dividend_yield, params.volatility).put_price;
+}
+
+template <class Curve>
+void Model::fill_price_curve(Curve& curve,
+                             const OptionParameters& base_params,
+                             double price_range,
+                             int num_points) {
+    Instrumentation::ScopedTimer timer(Instrumentation::Probe::PriceCurve);
     if (num_points <= 0) {
         throw std::invalid_argument("Number of points must be positive");
     }
+    if (!base_params.is_valid()) {
+        throw std::invalid_argument("Invalid parameters for Black-Scholes calculation");
+    }
     
-    std::vector<std::tuple<double, double, double>> curve;
+    timer.set_items(static_cast<std::uint64_t>(num_points));
+    curve.clear();
     curve.reserve(static_cast<size_t>(num_points));
     
     const double start_price = std::max(0.01, base_params.underlying_price - price_range);
     const double end_price = base_params.underlying_price + price_range;
-    const double step = (end_price - start_price) / static_cast<double>(num_points - 1);
+    if (!(end_price > 0.0) || !std::isfinite(end_price)) {
+        throw std::invalid_argument("Price range leaves no valid underlying prices");
+    }
+    const double step = num_points > 1 ? (end_price - start_price) / static_cast<double>(num_points - 1) : 0.0;
     
     for (int i = 0; i < num_points; ++i) {
         const double current_price = start_price + static_cast<double>(i) * step;
         
-        // Create modified parameters with current price
-        const OptionParameters current_params(
+        // Every point stays valid (price floored at 0.01), so skip per-point validation
+        const OptionParameters current_params = OptionParameters::trusted(
             current_price,
             base_params.strike_price,
             base_params.time_to_expiration,
             base_params.risk_free_rate,
-            base_params.volatility
+            base_params.volatility,
+            base_params.dividend_yield
         );
         
-        const double call = call_price(current_params);
-        const double put = put_price(current_params);
+        const double call = call_price_trusted(current_params);
+        const double put = put_price_trusted(current_params);
         
         curve.emplace_back(current_price, call, put);
     }
-    
+}
+
+std::vector<std::tuple<double, double, double>> 
+Model::generate_price_curve(const OptionParameters& base_params, 
+                           double price_range, 
+                           int num_points) {
+    std::vector<std::tuple<double, double, double>> curve;
+    fill_price_curve(curve, base_params, price_range, num_points);
+    return curve;
+}
+
+std::pmr::vector<std::tuple<double, double, double>>
+Model::generate_price_curve(const OptionParameters& base_params,
+                           double price_range,
+                           int num_points,
+                           std::pmr::memory_resource* resource) {
+    std::pmr::vector<std::tuple<double, double, double>> curve(resource);
+    fill_price_curve(curve, base_params, price_range, num_points);
     return curve;
 }
 
 // Private helper methods
-double Model::calculate_d1(double S, double K, double T, double r, double sigma) noexcept {
-    const double numerator = std::log(S / K) + (r + 0.5 * sigma * sigma) * T;
-    const double denominator = sigma * std::sqrt(T);
-    return numerator / denominator;
+double Model::calculate_d1(double S, double K, double T, double b, double sigma) noexcept {
+    return Kernel::d_terms(S, K, T, b, sigma).d1;
 }
 
 double Model::calculate_d2(double d1, double sigma, double T) noexcept {
@@ -169,28 +233,12 @@ double Model::calculate_d2(double d1, double sigma, double T) noexcept {
 }
 
 double Model::normal_cdf(double x) noexcept {
-    // Abramowitz and Stegun approximation with high accuracy
-    // Maximum error: 7.5 × 10^-8
-    constexpr double a1 =  0.254829592;
-    constexpr double a2 = -0.284496736;
-    constexpr double a3 =  1.421413741;
-    constexpr double a4 = -1.453152027;
-    constexpr double a5 =  1.061405429;
-    constexpr double p  =  0.3275911;
-    
-    const int sign = (x < 0) ? -1 : 1;
-    x = std::abs(x);
-    
-    // A&S formula 7.1.26
-    const double t = 1.0 / (1.0 + p * x);
-    const double y = 1.0 - (((((a5 * t + a4) * t) + a3) * t + a2) * t + a1) * t * std::exp(-x * x / 2.0);
-    
-    return 0.5 * (1.0 + sign * y);
+    // Tail-accurate erfc form, shared with the batch kernels
+    return Kernel::normal_cdf(x);
 }
 
 double Model::normal_pdf(double x) noexcept {
-    constexpr double inv_sqrt_2pi = 0.3989422804014327; // 1/sqrt(2*π)
-    return inv_sqrt_2pi * std::exp(-0.5 * x * x);
+    return Kernel::normal_pdf(x);
 }
 
 } // namespace BlackScholes
@@ -0,0 +1,98 @@
+#include "CarrMadanFft.hpp"
+#include "Fft.hpp"
+#include <algorithm>
+#include <numbers>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+bool FftGrid::is_valid() const noexcept {
+    return Fft::is_power_of_two(size) && size >= 16
+        && eta > 0.0 && alpha > 0.0 && std::isfinite(eta) && std::isfinite(alpha);
+}
+
+CarrMadanPricer::CarrMadanPricer(const FftGrid& grid, std::pmr::memory_resource* resource)
+    : grid_(grid)
+    , work_(resource)
+    , grid_strikes_(resource)
+    , grid_calls_(resource)
+{
+    if (!grid_.is_valid()) {
+        throw std::invalid_argument("Invalid Carr-Madan FFT grid");
+    }
+    work_.resize(grid_.size);
+    grid_strikes_.resize(grid_.size);
+    grid_calls_.resize(grid_.size);
+}
+
+double CarrMadanPricer::log_strike_spacing() const noexcept {
+    return 2.0 * std::numbers::pi / (static_cast<double>(grid_.size) * grid_.eta);
+}
+
+void CarrMadanPricer::validate(const OptionParameters& base) {
+    if (!base.is_valid()) {
+        throw std::invalid_argument("Invalid parameters for FFT calculation");
+    }
+}
+
+void CarrMadanPricer::transform(const OptionParameters& base, std::span<double> strikes, std::span<double> calls) {
+    const std::size_t N = grid_.size;
+    if (strikes.size() != N || calls.size() != N) {
+        throw std::invalid_argument("FFT output spans must match the grid size");
+    }
+
+    Fft::forward(work_);
+
+    // C(k_u) = e^{-α·k_u}/π · Re X_u with k_u = ln S + λ(u - N/2), written relative to S
+    const double S = base.underlying_price;
+    const double lambda = log_strike_spacing();
+    const double alpha = grid_.alpha;
+    for (std::size_t u = 0; u < N; ++u) {
+        const double log_moneyness = lambda * (static_cast<double>(u) - 0.5 * static_cast<double>(N));
+        strikes[u] = S * std::exp(log_moneyness);
+        calls[u] = std::max(0.0, S * std::exp(-alpha * log_moneyness) / std::numbers::pi * work_[u].real());
+    }
+}
+
+void CarrMadanPricer::interpolate(const OptionParameters& base, std::span<const double> strikes,
+                                  std::span<double> calls, std::span<double> puts) {
+    if (calls.size() != strikes.size() || puts.size() != strikes.size()) {
+        throw std::invalid_argument("Mismatched FFT strike sizes");
+    }
+
+    const double S = base.underlying_price;
+    const double T = base.time_to_expiration;
+    const double discount_factor = std::exp(-base.risk_free_rate * T);
+    const double forward_value = S * std::exp(-base.dividend_yield * T);
+    const double lambda = log_strike_spacing();
+    const double centre = 0.5 * static_cast<double>(grid_.size);
+    const auto last_start = static_cast<double>(grid_.size - 4);
+
+    for (std::size_t j = 0; j < strikes.size(); ++j) {
+        const double K = strikes[j];
+        if (!(K > 0.0) || !std::isfinite(K)) {
+            throw std::invalid_argument("FFT strikes must be positive");
+        }
+
+        // Four-point Lagrange stencil around the fractional grid index
+        const double position = std::log(K / S) / lambda + centre;
+        const double start = std::floor(position) - 1.0;
+        if (start < 0.0 || start > last_start) {
+            throw std::out_of_range("Strike lies outside the FFT grid");
+        }
+        const auto i0 = static_cast<std::size_t>(start);
+        const double t = position - start - 1.0;  // In [0, 1) between nodes 1 and 2
+
+        const double w0 = -t * (t - 1.0) * (t - 2.0) / 6.0;
+        const double w1 = (t + 1.0) * (t - 1.0) * (t - 2.0) / 2.0;
+        const double w2 = -(t + 1.0) * t * (t - 2.0) / 2.0;
+        const double w3 = (t + 1.0) * t * (t - 1.0) / 6.0;
+        const double call = std::max(0.0, w0 * grid_calls_[i0] + w1 * grid_calls_[i0 + 1]
+                                        + w2 * grid_calls_[i0 + 2] + w3 * grid_calls_[i0 + 3]);
+
+        calls[j] = call;
+        puts[j] = std::max(0.0, call - forward_value + K * discount_factor);  // Put-call parity
+    }
+}
+
+} // namespace BlackScholes
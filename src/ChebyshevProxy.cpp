@@ -0,0 +1,251 @@
+#include "ChebyshevProxy.hpp"
+#include "TraceEvents.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <numbers>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+namespace {
+
+constexpr char file_magic[8] = {'B', 'S', 'C', 'H', 'E', 'B', '0', '2'};
+
+/**
+ * @brief In-place Chebyshev transform of n values taken with the given stride
+ *
+ * Converts samples at the first-kind nodes cos(π(k+½)/n) into coefficients.
+ */
+void chebyshev_transform(double* values, int n, std::size_t stride) {
+    std::array<double, ChebyshevProxy::max_nodes> samples{};
+    for (int k = 0; k < n; ++k) {
+        samples[static_cast<std::size_t>(k)] = values[static_cast<std::size_t>(k) * stride];
+    }
+
+    const double scale = 2.0 / static_cast<double>(n);
+    for (int j = 0; j < n; ++j) {
+        double sum = 0.0;
+        for (int k = 0; k < n; ++k) {
+            sum += samples[static_cast<std::size_t>(k)]
+                 * std::cos(std::numbers::pi * j * (k + 0.5) / n);
+        }
+        values[static_cast<std::size_t>(j) * stride] = (j == 0 ? 0.5 : 1.0) * scale * sum;
+    }
+}
+
+double chebyshev_node(int k, int n, double lo, double hi) noexcept {
+    const double x = std::cos(std::numbers::pi * (k + 0.5) / n);
+    return lo + 0.5 * (x + 1.0) * (hi - lo);
+}
+
+/**
+ * @brief Extremum k of T_n, k in [0, n], mapped to [lo, hi]; k = 0 and n are the ends
+ */
+double chebyshev_extremum(int k, int n, double lo, double hi) noexcept {
+    if (k == 0) {
+        return hi;
+    }
+    if (k == n) {
+        return lo;
+    }
+    const double x = std::cos(std::numbers::pi * k / n);
+    return lo + 0.5 * (x + 1.0) * (hi - lo);
+}
+
+} // namespace
+
+bool ChebyshevBox::is_valid() const noexcept {
+    const auto interval_ok = [](double lo, double hi) {
+        return std::isfinite(lo) && std::isfinite(hi) && lo < hi;
+    };
+    return interval_ok(moneyness_min, moneyness_max)
+        && interval_ok(time_min, time_max)
+        && interval_ok(volatility_min, volatility_max);
+}
+
+ChebyshevProxy ChebyshevProxy::build(const Pricer& pricer,
+                                     const ChebyshevBox& box,
+                                     std::array<int, 3> nodes) {
+    if (!box.is_valid()) {
+        throw std::invalid_argument("Invalid Chebyshev box");
+    }
+    for (const int n : nodes) {
+        if (n < 2 || n > max_nodes) {
+            throw std::invalid_argument("Chebyshev node count must be in [2, 32]");
+        }
+    }
+
+    const auto [n_m, n_t, n_v] = nodes;
+    const auto nm = static_cast<std::size_t>(n_m);
+    const auto nt = static_cast<std::size_t>(n_t);
+    const auto nv = static_cast<std::size_t>(n_v);
+
+    ChebyshevProxy proxy;
+    proxy.box_ = box;
+    proxy.nodes_ = nodes;
+    proxy.coefficients_.resize(nm * nt * nv);
+    double* c = proxy.coefficients_.data();
+
+    // Sample the pricer on the tensor grid of Chebyshev nodes
+    for (int i = 0; i < n_m; ++i) {
+        const double m = chebyshev_node(i, n_m, box.moneyness_min, box.moneyness_max);
+        for (int j = 0; j < n_t; ++j) {
+            const double t = chebyshev_node(j, n_t, box.time_min, box.time_max);
+            for (int k = 0; k < n_v; ++k) {
+                const double v = chebyshev_node(k, n_v, box.volatility_min, box.volatility_max);
+                c[(static_cast<std::size_t>(i) * nt + static_cast<std::size_t>(j)) * nv
+                  + static_cast<std::size_t>(k)] = pricer(m, t, v);
+            }
+        }
+    }
+
+    // Separable transform: one 1D pass per dimension
+    for (std::size_t i = 0; i < nm; ++i) {
+        for (std::size_t j = 0; j < nt; ++j) {
+            chebyshev_transform(c + (i * nt + j) * nv, n_v, 1);
+        }
+    }
+    for (std::size_t i = 0; i < nm; ++i) {
+        for (std::size_t k = 0; k < nv; ++k) {
+            chebyshev_transform(c + i * nt * nv + k, n_t, nv);
+        }
+    }
+    for (std::size_t j = 0; j < nt; ++j) {
+        for (std::size_t k = 0; k < nv; ++k) {
+            chebyshev_transform(c + j * nv + k, n_m, nt * nv);
+        }
+    }
+
+    proxy.measure_error(pricer);
+    return proxy;
+}
+
+ChebyshevProxy ChebyshevProxy::load(const std::string& path) {
+    const Tracing::TraceSpan span("ChebyshevProxy::load", "io");
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open Chebyshev proxy file: " + path);
+    }
+
+    char magic[sizeof(file_magic)] = {};
+    in.read(magic, sizeof(magic));
+    if (!in || std::memcmp(magic, file_magic, sizeof(file_magic) - 2) != 0) {
+        throw std::runtime_error("Not a Chebyshev proxy file: " + path);
+    }
+    if (std::memcmp(magic, file_magic, sizeof(file_magic)) != 0) {
+        throw std::runtime_error("Unsupported Chebyshev proxy version, rebuild it: " + path);
+    }
+
+    ChebyshevProxy proxy;
+    std::array<std::int32_t, 3> nodes{};
+    in.read(reinterpret_cast<char*>(&proxy.box_), sizeof(proxy.box_));
+    in.read(reinterpret_cast<char*>(nodes.data()), sizeof(nodes));
+    in.read(reinterpret_cast<char*>(&proxy.max_error_), sizeof(proxy.max_error_));
+    if (!in || !proxy.box_.is_valid() || !(proxy.max_error_ >= 0.0)) {
+        throw std::runtime_error("Corrupt Chebyshev proxy header: " + path);
+    }
+
+    std::size_t count = 1;
+    for (std::size_t d = 0; d < nodes.size(); ++d) {
+        if (nodes[d] < 2 || nodes[d] > max_nodes) {
+            throw std::runtime_error("Corrupt Chebyshev proxy header: " + path);
+        }
+        proxy.nodes_[d] = static_cast<int>(nodes[d]);
+        count *= static_cast<std::size_t>(nodes[d]);
+    }
+
+    proxy.coefficients_.resize(count);
+    in.read(reinterpret_cast<char*>(proxy.coefficients_.data()),
+            static_cast<std::streamsize>(count * sizeof(double)));
+    if (!in) {
+        throw std::runtime_error("Truncated Chebyshev proxy file: " + path);
+    }
+    return proxy;
+}
+
+void ChebyshevProxy::save(const std::string& path) const {
+    const Tracing::TraceSpan span("ChebyshevProxy::save", "io");
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot create Chebyshev proxy file: " + path);
+    }
+
+    const std::array<std::int32_t, 3> nodes{nodes_[0], nodes_[1], nodes_[2]};
+    out.write(file_magic, sizeof(file_magic));
+    out.write(reinterpret_cast<const char*>(&box_), sizeof(box_));
+    out.write(reinterpret_cast<const char*>(nodes.data()), sizeof(nodes));
+    out.write(reinterpret_cast<const char*>(&max_error_), sizeof(max_error_));
+    out.write(reinterpret_cast<const char*>(coefficients_.data()),
+              static_cast<std::streamsize>(coefficients_.size() * sizeof(double)));
+    if (!out) {
+        throw std::runtime_error("Failed to write Chebyshev proxy file: " + path);
+    }
+}
+
+double ChebyshevProxy::evaluate(double moneyness, double time, double volatility) const {
+    if (!contains(moneyness, time, volatility)) {
+        throw std::out_of_range("Point outside the Chebyshev proxy box");
+    }
+
+    const double x_m = to_unit(moneyness, box_.moneyness_min, box_.moneyness_max);
+    const double x_t = to_unit(time, box_.time_min, box_.time_max);
+    const double x_v = to_unit(volatility, box_.volatility_min, box_.volatility_max);
+
+    const auto [n_m, n_t, n_v] = nodes_;
+    std::array<double, max_nodes> along_m{};
+    std::array<double, max_nodes> along_t{};
+
+    // Collapse σ, then T, then moneyness
+    const double* c = coefficients_.data();
+    for (int i = 0; i < n_m; ++i) {
+        for (int j = 0; j < n_t; ++j) {
+            along_t[static_cast<std::size_t>(j)] = clenshaw(c, n_v, x_v);
+            c += n_v;
+        }
+        along_m[static_cast<std::size_t>(i)] = clenshaw(along_t.data(), n_t, x_t);
+    }
+    return clenshaw(along_m.data(), n_m, x_m);
+}
+
+bool ChebyshevProxy::contains(double moneyness, double time, double volatility) const noexcept {
+    return moneyness >= box_.moneyness_min && moneyness <= box_.moneyness_max
+        && time >= box_.time_min && time <= box_.time_max
+        && volatility >= box_.volatility_min && volatility <= box_.volatility_max;
+}
+
+double ChebyshevProxy::to_unit(double x, double lo, double hi) noexcept {
+    return (2.0 * x - lo - hi) / (hi - lo);
+}
+
+double ChebyshevProxy::clenshaw(const double* coefficients, int n, double x) noexcept {
+    double b1 = 0.0;
+    double b2 = 0.0;
+    const double two_x = 2.0 * x;
+    for (int k = n - 1; k >= 1; --k) {
+        const double b0 = coefficients[k] + two_x * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+    return coefficients[0] + x * b1 - b2;
+}
+
+void ChebyshevProxy::measure_error(const Pricer& pricer) {
+    const auto [n_m, n_t, n_v] = nodes_;
+    double largest = 0.0;
+    for (int i = 0; i <= n_m; ++i) {
+        const double m = chebyshev_extremum(i, n_m, box_.moneyness_min, box_.moneyness_max);
+        for (int j = 0; j <= n_t; ++j) {
+            const double t = chebyshev_extremum(j, n_t, box_.time_min, box_.time_max);
+            for (int k = 0; k <= n_v; ++k) {
+                const double v = chebyshev_extremum(k, n_v, box_.volatility_min, box_.volatility_max);
+                largest = std::max(largest, std::abs(evaluate(m, t, v) - pricer(m, t, v)));
+            }
+        }
+    }
+    max_error_ = largest;
+}
+
+} // namespace BlackScholes
@@ -0,0 +1,295 @@
+#include "DoubleDouble.hpp"
+#include "Instrumentation.hpp"
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+namespace BlackScholes::HighPrecision {
+
+namespace {
+
+constexpr DoubleDouble ln2{0.69314718055994529, 2.3190468138462996e-17};
+constexpr DoubleDouble inv_sqrt2{0.70710678118654757, -4.8336466567264567e-17};
+constexpr DoubleDouble inv_sqrtpi{0.56418958354775628, 7.6677298065829406e-18};
+constexpr DoubleDouble inv_sqrt_2pi{0.3989422804014327, -2.49232720227773e-17};
+constexpr DoubleDouble two_over_sqrtpi{1.1283791670955126, 1.5335459613165881e-17};
+
+// 1/n! for n = 2..11, the e^r - 1 series after the linear term
+constexpr std::array<DoubleDouble, 10> inverse_factorials{
+    DoubleDouble(0.5, 0.0),
+    DoubleDouble(0.16666666666666666, 9.2518585385429707e-18),
+    DoubleDouble(0.041666666666666664, 2.3129646346357427e-18),
+    DoubleDouble(0.0083333333333333332, 1.1564823173178714e-19),
+    DoubleDouble(0.0013888888888888889, -5.3005439543735771e-20),
+    DoubleDouble(0.00019841269841269841, 1.7209558293420705e-22),
+    DoubleDouble(2.4801587301587302e-05, 2.1511947866775882e-23),
+    DoubleDouble(2.7557319223985893e-06, -1.8583932740464721e-22),
+    DoubleDouble(2.7557319223985888e-07, 2.3767714622250297e-23),
+    DoubleDouble(2.505210838544172e-08, -1.448814070935912e-24)
+};
+
+/**
+ * @brief N(x) and N(-x) from a single erfc of |x|
+ *
+ * The smaller of the two is the tail itself and the larger is 1 minus it,
+ * which is exact to double-double precision because it is close to 1.
+ */
+struct NormalTails {
+    DoubleDouble lower;  ///< N(x)
+    DoubleDouble upper;  ///< N(-x)
+};
+
+NormalTails normal_tails(const DoubleDouble& x) noexcept {
+    const DoubleDouble tail = ldexp(erfc(abs(x) * inv_sqrt2), -1);
+    const DoubleDouble body = DoubleDouble(1.0) - tail;
+    return x.hi < 0.0 ? NormalTails{tail, body} : NormalTails{body, tail};
+}
+
+/**
+ * @brief Quantities shared by the price and value entry points
+ */
+struct Setup {
+    DoubleDouble b;
+    DoubleDouble sqrt_T;
+    DoubleDouble sigma_sqrt_T;
+    DoubleDouble d1;
+    NormalTails n1;  ///< N(d₁), N(-d₁)
+    NormalTails n2;  ///< N(d₂), N(-d₂)
+    DoubleDouble carry_factor;
+    DoubleDouble S_carry;
+    DoubleDouble K_discount;
+    DoubleDouble call;
+    DoubleDouble put;
+};
+
+template <class Variant>
+Setup setup(double S_in, double K_in, double T_in, double r_in, double q_in, double sigma_in) noexcept {
+    const DoubleDouble S = S_in;
+    const DoubleDouble K = K_in;
+    const DoubleDouble T = T_in;
+    const DoubleDouble r = r_in;
+    const DoubleDouble sigma = sigma_in;
+
+    Setup s;
+    s.b = Variant::carry(r, DoubleDouble(q_in));
+    s.sqrt_T = sqrt(T);
+    s.sigma_sqrt_T = sigma * s.sqrt_T;
+    s.d1 = (log(S / K) + (s.b + ldexp(sigma * sigma, -1)) * T) / s.sigma_sqrt_T;
+    s.n1 = normal_tails(s.d1);
+    s.n2 = normal_tails(s.d1 - s.sigma_sqrt_T);
+
+    s.carry_factor = exp((s.b - r) * T);
+    s.S_carry = S * s.carry_factor;
+    s.K_discount = K * exp(-r * T);
+
+    s.call = s.S_carry * s.n1.lower - s.K_discount * s.n2.lower;
+    s.put = s.K_discount * s.n2.upper - s.S_carry * s.n1.upper;
+    return s;
+}
+
+} // namespace
+
+DoubleDouble sqrt(const DoubleDouble& a) noexcept {
+    if (a.hi <= 0.0) {
+        return a.hi == 0.0 ? DoubleDouble() : DoubleDouble(std::numeric_limits<double>::quiet_NaN());
+    }
+    const double inv_root = 1.0 / std::sqrt(a.hi);
+    const double root = a.hi * inv_root;
+    return two_sum(root, (a - two_prod(root, root)).hi * (inv_root * 0.5));
+}
+
+DoubleDouble exp(const DoubleDouble& a) noexcept {
+    if (std::isnan(a.hi)) {
+        return a;
+    }
+    if (a.hi > 709.782712893384) {
+        return DoubleDouble(std::numeric_limits<double>::infinity());
+    }
+    if (a.hi < -745.1332191019412) {
+        return DoubleDouble();
+    }
+
+    // e^a = 2ᵏ·e^r with |r| ≤ ln2/2; r/1024 makes the series converge in 11 terms
+    constexpr int halvings = 10;
+    const double k = std::nearbyint(a.hi / ln2.hi);
+    const DoubleDouble r = ldexp(a - ln2 * k, -halvings);
+
+    // Horner form of r + r²/2! + ... + r¹¹/11!
+    DoubleDouble expm1 = inverse_factorials.back();
+    for (auto it = inverse_factorials.rbegin() + 1; it != inverse_factorials.rend(); ++it) {
+        expm1 = expm1 * r + *it;
+    }
+    expm1 = (expm1 * r + 1.0) * r;
+
+    // Square back up on e^r - 1, avoiding the cancellation of squaring e^r itself
+    for (int i = 0; i < halvings; ++i) {
+        expm1 = expm1 * (expm1 + 2.0);
+    }
+    return ldexp(expm1 + 1.0, static_cast<int>(k));
+}
+
+DoubleDouble log(const DoubleDouble& a) noexcept {
+    if (a.hi <= 0.0) {
+        return DoubleDouble(a.hi == 0.0 ? -std::numeric_limits<double>::infinity()
+                                        : std::numeric_limits<double>::quiet_NaN());
+    }
+    if (std::isinf(a.hi)) {
+        return a;
+    }
+    const DoubleDouble x = std::log(a.hi);
+    return x + a * exp(-x) - 1.0;
+}
+
+DoubleDouble erfc(const DoubleDouble& x) noexcept {
+    if (std::isnan(x.hi)) {
+        return x;
+    }
+    if (x.hi < 0.0) {
+        return DoubleDouble(2.0) - erfc(-x);
+    }
+    if (x.hi > 27.3) {
+        return DoubleDouble();
+    }
+
+    const DoubleDouble x2 = x * x;
+    if (x.hi < 3.0) {
+        // erf(x) = 2/√π·e^(-x²)·Σ 2ⁿx^(2n+1)/(2n+1)!!, all terms positive
+        const DoubleDouble two_x2 = ldexp(x2, 1);
+        DoubleDouble term = x;
+        DoubleDouble sum = x;
+        for (int n = 1; n < 200 && term.hi > 1e-34 * sum.hi; ++n) {
+            term = term * two_x2 / static_cast<double>(2 * n + 1);
+            sum += term;
+        }
+        return DoubleDouble(1.0) - two_over_sqrtpi * exp(-x2) * sum;
+    }
+
+    // erfc(x) = 2x·e^(-x²)/√π · 1/(2x² + 1 - 1·2/(2x² + 5 - 3·4/(2x² + 9 - ...))), evaluated
+    // bottom-up; about 600/x² terms reach full precision
+    const DoubleDouble two_x2 = ldexp(x2, 1);
+    const int terms = static_cast<int>(600.0 / x2.hi) + 8;
+    DoubleDouble fraction = two_x2 + (4.0 * terms + 1.0);
+    for (int k = terms; k >= 1; --k) {
+        const double numerator = (2.0 * k - 1.0) * (2.0 * k);
+        fraction = two_x2 + (4.0 * k - 3.0) - DoubleDouble(numerator) / fraction;
+    }
+    return x * two_over_sqrtpi * exp(-x2) / fraction;
+}
+
+DoubleDouble normal_cdf(const DoubleDouble& x) noexcept {
+    return normal_tails(x).lower;
+}
+
+DoubleDouble normal_pdf(const DoubleDouble& x) noexcept {
+    return inv_sqrt_2pi * exp(-ldexp(x * x, -1));
+}
+
+OptionPrices ExtendedPrices::rounded() const noexcept {
+    return OptionPrices{
+        .call_price = static_cast<double>(call_price),
+        .put_price = static_cast<double>(put_price),
+        .delta_call = static_cast<double>(delta_call),
+        .delta_put = static_cast<double>(delta_put),
+        .gamma = static_cast<double>(gamma),
+        .theta_call = static_cast<double>(theta_call),
+        .theta_put = static_cast<double>(theta_put),
+        .vega = static_cast<double>(vega),
+        .rho_call = static_cast<double>(rho_call),
+        .rho_put = static_cast<double>(rho_put)
+    };
+}
+
+template <class Variant>
+ExtendedPrices price_extended(double S, double K, double T, double r, double q, double sigma) noexcept {
+    const Setup s = setup<Variant>(S, K, T, r, q, sigma);
+    const DoubleDouble rate = r;
+    const DoubleDouble phi_d1 = normal_pdf(s.d1);
+
+    const DoubleDouble time_decay = -(s.S_carry * phi_d1 * sigma) / (2.0 * s.sqrt_T);
+    const DoubleDouble carry_spread = s.b - rate;
+    const DoubleDouble theta_call = time_decay - carry_spread * s.S_carry * s.n1.lower
+                                  - rate * s.K_discount * s.n2.lower;
+    const DoubleDouble theta_put = time_decay + carry_spread * s.S_carry * s.n1.upper
+                                 + rate * s.K_discount * s.n2.upper;
+
+    DoubleDouble rho_call;
+    DoubleDouble rho_put;
+    if constexpr (Variant::rate_in_carry) {
+        rho_call = s.K_discount * T * s.n2.lower;
+        rho_put = -(s.K_discount * T * s.n2.upper);
+    } else {
+        rho_call = -(T * s.call);
+        rho_put = -(T * s.put);
+    }
+
+    return ExtendedPrices{
+        .call_price = s.call,
+        .put_price = s.put,
+        .delta_call = s.carry_factor * s.n1.lower,
+        .delta_put = -(s.carry_factor * s.n1.upper),
+        .gamma = s.carry_factor * phi_d1 / (S * s.sigma_sqrt_T),
+        .theta_call = theta_call / 365.25,
+        .theta_put = theta_put / 365.25,
+        .vega = s.S_carry * phi_d1 * s.sqrt_T / 100.0,
+        .rho_call = rho_call / 100.0,
+        .rho_put = rho_put / 100.0
+    };
+}
+
+template <class Variant>
+Kernel::OptionValues value(double S, double K, double T, double r, double q, double sigma) noexcept {
+    const Setup s = setup<Variant>(S, K, T, r, q, sigma);
+    return Kernel::OptionValues{
+        .call_price = static_cast<double>(s.call),
+        .put_price = static_cast<double>(s.put)
+    };
+}
+
+template <class Variant>
+void price_batch(const OptionBatch& batch, std::span<OptionPrices> out) {
+    if (!batch.is_consistent() || out.size() != batch.size()) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+
+    const std::size_t n = batch.size();
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::BatchPricing, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = price<Variant>(batch.underlying_price[i], batch.strike_price[i],
+                                batch.time_to_expiration[i], batch.risk_free_rate[i],
+                                batch.dividend_yield[i], batch.volatility[i]);
+    }
+}
+
+template <class Variant>
+void value_batch(const OptionBatch& batch, std::span<double> call, std::span<double> put) {
+    if (!batch.is_consistent() || call.size() != batch.size() || put.size() != batch.size()) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+
+    const std::size_t n = batch.size();
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::BatchPricing, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Kernel::OptionValues v = value<Variant>(batch.underlying_price[i], batch.strike_price[i],
+                                                      batch.time_to_expiration[i], batch.risk_free_rate[i],
+                                                      batch.dividend_yield[i], batch.volatility[i]);
+        call[i] = v.call_price;
+        put[i] = v.put_price;
+    }
+}
+
+template ExtendedPrices price_extended<BlackScholesMerton>(double, double, double, double, double, double) noexcept;
+template Kernel::OptionValues value<BlackScholesMerton>(double, double, double, double, double, double) noexcept;
+template void price_batch<BlackScholesMerton>(const OptionBatch&, std::span<OptionPrices>);
+template void value_batch<BlackScholesMerton>(const OptionBatch&, std::span<double>, std::span<double>);
+
+template ExtendedPrices price_extended<Black76>(double, double, double, double, double, double) noexcept;
+template Kernel::OptionValues value<Black76>(double, double, double, double, double, double) noexcept;
+template void price_batch<Black76>(const OptionBatch&, std::span<OptionPrices>);
+template void value_batch<Black76>(const OptionBatch&, std::span<double>, std::span<double>);
+
+template ExtendedPrices price_extended<GarmanKohlhagen>(double, double, double, double, double, double) noexcept;
+template Kernel::OptionValues value<GarmanKohlhagen>(double, double, double, double, double, double) noexcept;
+template void price_batch<GarmanKohlhagen>(const OptionBatch&, std::span<OptionPrices>);
+template void value_batch<GarmanKohlhagen>(const OptionBatch&, std::span<double>, std::span<double>);
+
+} // namespace BlackScholes::HighPrecision
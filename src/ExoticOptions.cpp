@@ -0,0 +1,176 @@
+#include "ExoticOptions.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace BlackScholes::Exotics {
+
+namespace {
+
+using Kernel::normal_cdf;
+
+void check_sizes(const OptionBatch& batch, std::size_t calls, std::size_t puts) {
+    if (!batch.is_consistent() || calls != batch.size() || puts != batch.size()) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+}
+
+/**
+ * @brief Run a call/put pricer over every row of a batch
+ */
+template <class Pricer>
+void for_each_row(const OptionBatch& batch, std::span<double> calls, std::span<double> puts, const Pricer& pricer) {
+    check_sizes(batch, calls.size(), puts.size());
+
+    const std::size_t n = batch.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        const Kernel::OptionValues v = pricer(batch.underlying_price[i], batch.strike_price[i],
+                                              batch.time_to_expiration[i], batch.risk_free_rate[i],
+                                              batch.dividend_yield[i], batch.volatility[i]);
+        calls[i] = v.call_price;
+        puts[i] = v.put_price;
+    }
+}
+
+} // namespace
+
+double barrier_price(OptionType type, const BarrierSpec& spec,
+                     double S, double K, double T, double r, double q, double sigma) noexcept {
+    const double H = spec.barrier;
+    const double R = spec.rebate;
+    const bool down = spec.type == BarrierType::DownAndIn || spec.type == BarrierType::DownAndOut;
+    const bool knock_in = spec.type == BarrierType::DownAndIn || spec.type == BarrierType::UpAndIn;
+    const bool call = type == OptionType::Call;
+
+    // Already through the barrier: in options become vanillas, out options pay the rebate now
+    if (down ? S <= H : S >= H) {
+        if (!knock_in) {
+            return R;
+        }
+        const Kernel::OptionValues vanilla = Kernel::value<BlackScholesMerton>(S, K, T, r, q, sigma);
+        return call ? vanilla.call_price : vanilla.put_price;
+    }
+
+    // Haug's notation: φ = ±1 for call/put, η = ±1 for down/up barriers
+    const double phi = call ? 1.0 : -1.0;
+    const double eta = down ? 1.0 : -1.0;
+    const double b = r - q;
+    const double sigma_sqrt_T = sigma * std::sqrt(T);
+    const double mu = (b - 0.5 * sigma * sigma) / (sigma * sigma);
+    const double lambda = std::sqrt(mu * mu + 2.0 * r / (sigma * sigma));
+
+    const double x1 = Kernel::d_terms(S, K, T, b, sigma).d1;
+    const double x2 = Kernel::d_terms(S, H, T, b, sigma).d1;
+    const double y1 = Kernel::d_terms(H * H, S * K, T, b, sigma).d1;
+    const double y2 = Kernel::d_terms(H, S, T, b, sigma).d1;
+    const double z = std::log(H / S) / sigma_sqrt_T + lambda * sigma_sqrt_T;
+
+    const double S_carry = S * std::exp((b - r) * T);
+    const double K_discount = K * std::exp(-r * T);
+    const double ratio = H / S;
+    const double ratio_2mu = std::pow(ratio, 2.0 * mu);
+    const double ratio_2mu_2 = ratio_2mu * ratio * ratio;
+
+    const double A = phi * S_carry * normal_cdf(phi * x1) - phi * K_discount * normal_cdf(phi * (x1 - sigma_sqrt_T));
+    const double B = phi * S_carry * normal_cdf(phi * x2) - phi * K_discount * normal_cdf(phi * (x2 - sigma_sqrt_T));
+    const double C = phi * S_carry * ratio_2mu_2 * normal_cdf(eta * y1)
+                   - phi * K_discount * ratio_2mu * normal_cdf(eta * (y1 - sigma_sqrt_T));
+    const double D = phi * S_carry * ratio_2mu_2 * normal_cdf(eta * y2)
+                   - phi * K_discount * ratio_2mu * normal_cdf(eta * (y2 - sigma_sqrt_T));
+    const double E = R * std::exp(-r * T) * (normal_cdf(eta * (x2 - sigma_sqrt_T))
+                                             - ratio_2mu * normal_cdf(eta * (y2 - sigma_sqrt_T)));
+    const double F = R * (std::pow(ratio, mu + lambda) * normal_cdf(eta * z)
+                          + std::pow(ratio, mu - lambda) * normal_cdf(eta * (z - 2.0 * lambda * sigma_sqrt_T)));
+
+    // Reiner-Rubinstein combinations; a strike above the barrier is "high"
+    const bool high = K > H;
+    switch (spec.type) {
+        case BarrierType::DownAndIn:
+            if (call) {
+                return high ? C + E : A - B + D + E;
+            }
+            return high ? B - C + D + E : A + E;
+        case BarrierType::UpAndIn:
+            if (call) {
+                return high ? A + E : B - C + D + E;
+            }
+            return high ? A - B + D + E : C + E;
+        case BarrierType::DownAndOut:
+            if (call) {
+                return high ? A - C + F : B - D + F;
+            }
+            return high ? A - B + C - D + F : F;
+        case BarrierType::UpAndOut:
+            if (call) {
+                return high ? F : A - B + C - D + F;
+            }
+            return high ? B - D + F : A - C + F;
+    }
+    return 0.0;
+}
+
+void barrier_batch(OptionType type, BarrierType barrier_type, const OptionBatch& batch,
+                   std::span<const double> barriers, std::span<const double> rebates,
+                   std::span<double> out) {
+    if (!batch.is_consistent() || barriers.size() != batch.size() || out.size() != batch.size()
+        || (!rebates.empty() && rebates.size() != batch.size())) {
+        throw std::invalid_argument("Mismatched batch sizes");
+    }
+
+    const std::size_t n = batch.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        const BarrierSpec spec{
+            .type = barrier_type,
+            .barrier = barriers[i],
+            .rebate = rebates.empty() ? 0.0 : rebates[i]
+        };
+        out[i] = barrier_price(type, spec, batch.underlying_price[i], batch.strike_price[i],
+                               batch.time_to_expiration[i], batch.risk_free_rate[i],
+                               batch.dividend_yield[i], batch.volatility[i]);
+    }
+}
+
+Kernel::OptionValues cash_or_nothing(double S, double K, double T, double r, double q,
+                                     double sigma, double cash) noexcept {
+    const double d2 = Kernel::d_terms(S, K, T, r - q, sigma).d2;
+    const double cash_discount = cash * std::exp(-r * T);
+    return Kernel::OptionValues{
+        .call_price = cash_discount * normal_cdf(d2),
+        .put_price = cash_discount * normal_cdf(-d2)
+    };
+}
+
+Kernel::OptionValues asset_or_nothing(double S, double K, double T, double r, double q,
+                                      double sigma) noexcept {
+    const double d1 = Kernel::d_terms(S, K, T, r - q, sigma).d1;
+    const double S_carry = S * std::exp(-q * T);
+    return Kernel::OptionValues{
+        .call_price = S_carry * normal_cdf(d1),
+        .put_price = S_carry * normal_cdf(-d1)
+    };
+}
+
+Kernel::OptionValues geometric_asian(double S, double K, double T, double r, double q,
+                                     double sigma) noexcept {
+    // Adjusted carry b_A = (b - σ²/6)/2 and volatility σ_A = σ/√3, expressed as a yield
+    const double b = r - q;
+    const double b_average = 0.5 * (b - sigma * sigma / 6.0);
+    const double sigma_average = sigma / std::sqrt(3.0);
+    return Kernel::value<BlackScholesMerton>(S, K, T, r, r - b_average, sigma_average);
+}
+
+void cash_or_nothing_batch(const OptionBatch& batch, double cash,
+                           std::span<double> calls, std::span<double> puts) {
+    for_each_row(batch, calls, puts, [cash](double S, double K, double T, double r, double q, double sigma) {
+        return cash_or_nothing(S, K, T, r, q, sigma, cash);
+    });
+}
+
+void asset_or_nothing_batch(const OptionBatch& batch, std::span<double> calls, std::span<double> puts) {
+    for_each_row(batch, calls, puts, asset_or_nothing);
+}
+
+void geometric_asian_batch(const OptionBatch& batch, std::span<double> calls, std::span<double> puts) {
+    for_each_row(batch, calls, puts, geometric_asian);
+}
+
+} // namespace BlackScholes::Exotics
@@ -0,0 +1,104 @@
+#include "Fft.hpp"
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <utility>
+
+namespace BlackScholes::Fft {
+
+namespace {
+
+using Complex = std::complex<double>;
+
+void bit_reverse(std::span<Complex> data) noexcept {
+    const std::size_t n = data.size();
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+        std::size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(data[i], data[j]);
+        }
+    }
+}
+
+} // namespace
+
+void forward(std::span<Complex> data) {
+    const std::size_t n = data.size();
+    if (!is_power_of_two(n)) {
+        throw std::invalid_argument("FFT length must be a power of two");
+    }
+    if (n == 1) {
+        return;
+    }
+
+    bit_reverse(data);
+
+    std::size_t len = 1;
+    std::size_t log2n = 0;
+    while ((std::size_t{1} << log2n) < n) {
+        ++log2n;
+    }
+
+    // Odd number of radix-2 stages: do one here so the rest pair up as radix-4
+    if (log2n % 2 == 1) {
+        for (std::size_t i = 0; i < n; i += 2) {
+            const Complex a = data[i];
+            const Complex b = data[i + 1];
+            data[i] = a + b;
+            data[i + 1] = a - b;
+        }
+        len = 2;
+    }
+
+    // Radix-4 stages. In bit-reversed order a block of length 4q holds the
+    // sub-transforms of samples ≡ 0, 2, 1, 3 (mod 4) in its four quarters.
+    const Complex minus_i(0.0, -1.0);
+    while (len < n) {
+        const std::size_t quarter = len;
+        len *= 4;
+        const double angle = -2.0 * std::numbers::pi / static_cast<double>(len);
+
+        for (std::size_t j = 0; j < quarter; ++j) {
+            const Complex w1 = std::polar(1.0, angle * static_cast<double>(j));
+            const Complex w2 = w1 * w1;
+            const Complex w3 = w2 * w1;
+
+            for (std::size_t base = 0; base < n; base += len) {
+                const std::size_t i0 = base + j;
+                const Complex a = data[i0];
+                const Complex b = w2 * data[i0 + quarter];
+                const Complex c = w1 * data[i0 + 2 * quarter];
+                const Complex d = w3 * data[i0 + 3 * quarter];
+
+                const Complex a_plus_b = a + b;
+                const Complex a_minus_b = a - b;
+                const Complex c_plus_d = c + d;
+                const Complex rot = minus_i * (c - d);
+
+                data[i0] = a_plus_b + c_plus_d;
+                data[i0 + quarter] = a_minus_b + rot;
+                data[i0 + 2 * quarter] = a_plus_b - c_plus_d;
+                data[i0 + 3 * quarter] = a_minus_b - rot;
+            }
+        }
+    }
+}
+
+void inverse(std::span<Complex> data) {
+    // Conjugation trick: IDFT(x) = conj(DFT(conj(x))) / N
+    for (Complex& value : data) {
+        value = std::conj(value);
+    }
+    forward(data);
+
+    const double scale = 1.0 / static_cast<double>(data.size());
+    for (Complex& value : data) {
+        value = std::conj(value) * scale;
+    }
+}
+
+} // namespace BlackScholes::Fft
@@ -0,0 +1,93 @@
+#include "GreeksProxy.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+GreeksProxy::GreeksProxy(const OptionParameters& base, ProxyConfig config)
+    : config_(config)
+    , base_prices_(Model::calculate_prices(base))
+    , anchor_(base)
+    , anchor_prices_(base_prices_)
+{
+}
+
+PnLEstimate GreeksProxy::estimate(const OptionParameters& current) {
+    if (!current.is_valid()) {
+        throw std::invalid_argument("Invalid parameters for proxy estimate");
+    }
+    if (current.strike_price != anchor_.strike_price) {
+        throw std::invalid_argument("Proxy strike does not match the anchored option");
+    }
+
+    ++report_.estimates;
+    const PnLEstimate approx = taylor(current);
+
+    if (config_.sample_interval == 0 || ++since_last_sample_ < config_.sample_interval) {
+        return approx;
+    }
+    since_last_sample_ = 0;
+
+    // Sampled full revaluation to measure the proxy error
+    const OptionPrices full_prices = Model::calculate_prices(current);
+    const PnLEstimate exact = revalue(full_prices);
+    const double error = std::max(std::abs(approx.call_pnl - exact.call_pnl),
+                                  std::abs(approx.put_pnl - exact.put_pnl));
+
+    ++report_.samples;
+    report_.last_abs_error = error;
+    report_.max_abs_error = std::max(report_.max_abs_error, error);
+    report_.mean_abs_error += (error - report_.mean_abs_error) / static_cast<double>(report_.samples);
+
+    if (error <= config_.error_threshold) {
+        return approx;
+    }
+
+    // Proxy has drifted too far - fall back and re-anchor on the full revaluation
+    ++report_.fallbacks;
+    anchor_ = current;
+    anchor_prices_ = full_prices;
+    return exact;
+}
+
+void GreeksProxy::rebase(const OptionParameters& current) {
+    anchor_prices_ = Model::calculate_prices(current);
+    anchor_ = current;
+    since_last_sample_ = 0;
+}
+
+PnLEstimate GreeksProxy::taylor(const OptionParameters& current) const noexcept {
+    const double dS = current.underlying_price - anchor_.underlying_price;
+    const double dvol_pct = (current.volatility - anchor_.volatility) * 100.0;
+    const double days = (anchor_.time_to_expiration - current.time_to_expiration) * 365.25;
+    const double dr_pct = (current.risk_free_rate - anchor_.risk_free_rate) * 100.0;
+    const double dq = current.dividend_yield - anchor_.dividend_yield;
+
+    const double gamma_term = 0.5 * anchor_prices_.gamma * dS * dS;
+    const double vega_term = anchor_prices_.vega * dvol_pct;
+
+    // Dividend sensitivity ∂V/∂q = -T·S·Δ under Black-Scholes-Merton
+    const double carry_exposure = -anchor_.time_to_expiration * anchor_.underlying_price * dq;
+
+    // Offset by the PnL already realised between the start of day and the anchor
+    const double call_offset = anchor_prices_.call_price - base_prices_.call_price;
+    const double put_offset = anchor_prices_.put_price - base_prices_.put_price;
+
+    return PnLEstimate{
+        .call_pnl = call_offset + anchor_prices_.delta_call * (dS + carry_exposure) + gamma_term
+                  + vega_term + anchor_prices_.theta_call * days + anchor_prices_.rho_call * dr_pct,
+        .put_pnl = put_offset + anchor_prices_.delta_put * (dS + carry_exposure) + gamma_term
+                 + vega_term + anchor_prices_.theta_put * days + anchor_prices_.rho_put * dr_pct,
+        .full_revaluation = false
+    };
+}
+
+PnLEstimate GreeksProxy::revalue(const OptionPrices& prices) const noexcept {
+    return PnLEstimate{
+        .call_pnl = prices.call_price - base_prices_.call_price,
+        .put_pnl = prices.put_price - base_prices_.put_price,
+        .full_revaluation = true
+    };
+}
+
+} // namespace BlackScholes
@@ -0,0 +1,186 @@
+#include "GreeksSurface.hpp"
+#include "Instrumentation.hpp"
+#include "PricingKernel.hpp"
+#include "TraceEvents.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+namespace {
+
+/**
+ * @brief Terms shared by every cell of one row
+ */
+struct RowTerms {
+    double T;
+    double sqrt_T;
+    double sigma_sqrt_T;
+    double inv_sigma_sqrt_T;
+    double drift_T;         ///< (b + σ²/2)T
+    double carry_factor;    ///< e^((b-r)T)
+    double K_discount;      ///< K·e^(-rT)
+    double decay_scale;     ///< -σ/(2√T)
+};
+
+RowTerms row_terms(double K, double T, double r, double q, double sigma) noexcept {
+    const double b = BlackScholesMerton::carry(r, q);
+    const double sqrt_T = std::sqrt(T);
+    const double sigma_sqrt_T = sigma * sqrt_T;
+    return RowTerms{
+        .T = T,
+        .sqrt_T = sqrt_T,
+        .sigma_sqrt_T = sigma_sqrt_T,
+        .inv_sigma_sqrt_T = 1.0 / sigma_sqrt_T,
+        .drift_T = (b + 0.5 * sigma * sigma) * T,
+        .carry_factor = std::exp((b - r) * T),
+        .K_discount = K * std::exp(-r * T),
+        .decay_scale = -sigma / (2.0 * sqrt_T)
+    };
+}
+
+/**
+ * @brief Evenly spaced grid value, exact at both ends
+ */
+double grid_point(double first, double last, std::size_t index, std::size_t count) noexcept {
+    if (index + 1 == count) {
+        return last;
+    }
+    return first + (last - first) * static_cast<double>(index) / static_cast<double>(count - 1);
+}
+
+} // namespace
+
+bool SurfaceSpec::is_valid() const noexcept {
+    return columns >= 2 && rows >= 2
+        && spot_min > 0.0 && spot_max > spot_min && std::isfinite(spot_max)
+        && axis_min > 0.0 && axis_max > axis_min && std::isfinite(axis_max);
+}
+
+// GreeksSurface implementation
+GreeksSurface::GreeksSurface(unsigned num_threads, std::pmr::memory_resource* resource)
+    : num_threads_(num_threads)
+    , values_(resource)
+    , spots_(resource)
+    , log_moneyness_(resource)
+    , row_ranges_(resource) {}
+
+std::span<const double> GreeksSurface::plane(OptionField field) const noexcept {
+    if (values_.empty()) {
+        return {};
+    }
+    const std::size_t cells = spec_.rows * spec_.columns;
+    return std::span<const double>(values_).subspan(static_cast<std::size_t>(field) * cells, cells);
+}
+
+void GreeksSurface::compute(const OptionParameters& base, const SurfaceSpec& spec) {
+    if (!base.is_valid()) {
+        throw std::invalid_argument("Invalid parameters for Greeks surface");
+    }
+    if (!spec.is_valid()) {
+        throw std::invalid_argument("Invalid Greeks surface grid");
+    }
+
+    const std::size_t rows = spec.rows;
+    const std::size_t columns = spec.columns;
+    const std::size_t cells = rows * columns;
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::SurfaceGrid, cells);
+    const Tracing::TraceSpan span("GreeksSurface::compute", "pricing", static_cast<std::int64_t>(cells));
+
+    // values_ is resized last and the new shape adopted only once it holds,
+    // so a failed allocation leaves plane() slicing the old extent
+    spots_.resize(columns);
+    log_moneyness_.resize(columns);
+    row_ranges_.resize(rows * option_field_count);
+    values_.resize(option_field_count * cells);
+    spec_ = spec;
+
+    const double K = base.strike_price;
+    const double r = base.risk_free_rate;
+    const double q = base.dividend_yield;
+    const double b = BlackScholesMerton::carry(r, q);
+
+    // Column terms, shared by every row
+    for (std::size_t j = 0; j < columns; ++j) {
+        spots_[j] = grid_point(spec.spot_min, spec.spot_max, j, columns);
+        log_moneyness_[j] = std::log(spots_[j] / K);
+    }
+
+    auto price_row = [&](std::size_t i) noexcept {
+        const double value = grid_point(spec.axis_max, spec.axis_min, i, rows);
+        const RowTerms row = spec.axis == SurfaceAxis::Volatility
+            ? row_terms(K, base.time_to_expiration, r, q, value)
+            : row_terms(K, value, r, q, base.volatility);
+
+        auto row_of = [&](OptionField field) noexcept {
+            return values_.data() + static_cast<std::size_t>(field) * cells + i * columns;
+        };
+        double* const call_price = row_of(OptionField::CallPrice);
+        double* const put_price = row_of(OptionField::PutPrice);
+        double* const delta_call = row_of(OptionField::DeltaCall);
+        double* const delta_put = row_of(OptionField::DeltaPut);
+        double* const gamma = row_of(OptionField::Gamma);
+        double* const theta_call = row_of(OptionField::ThetaCall);
+        double* const theta_put = row_of(OptionField::ThetaPut);
+        double* const vega = row_of(OptionField::Vega);
+        double* const rho_call = row_of(OptionField::RhoCall);
+        double* const rho_put = row_of(OptionField::RhoPut);
+
+        // Same formulas and units as Kernel::price<BlackScholesMerton>
+        for (std::size_t j = 0; j < columns; ++j) {
+            const double S = spots_[j];
+            const double d1 = (log_moneyness_[j] + row.drift_T) * row.inv_sigma_sqrt_T;
+            const auto [N_d1, N_neg_d1, phi_d1] = Kernel::normal_tails(d1);
+            const Kernel::NormalTails tails_d2 = Kernel::normal_tails(d1 - row.sigma_sqrt_T);
+            const double N_d2 = tails_d2.lower;
+            const double N_neg_d2 = tails_d2.upper;
+
+            const double S_carry = S * row.carry_factor;
+            const double time_decay = S_carry * phi_d1 * row.decay_scale;
+
+            call_price[j] = S_carry * N_d1 - row.K_discount * N_d2;
+            put_price[j] = row.K_discount * N_neg_d2 - S_carry * N_neg_d1;
+            delta_call[j] = row.carry_factor * N_d1;
+            delta_put[j] = -row.carry_factor * N_neg_d1;
+            gamma[j] = row.carry_factor * phi_d1 * row.inv_sigma_sqrt_T / S;
+            theta_call[j] = (time_decay - (b - r) * S_carry * N_d1 - r * row.K_discount * N_d2) / 365.25;
+            theta_put[j] = (time_decay + (b - r) * S_carry * N_neg_d1 + r * row.K_discount * N_neg_d2) / 365.25;
+            vega[j] = S_carry * phi_d1 * row.sqrt_T / 100.0;
+            rho_call[j] = row.K_discount * row.T * N_d2 / 100.0;
+            rho_put[j] = -row.K_discount * row.T * N_neg_d2 / 100.0;
+        }
+
+        for (std::size_t f = 0; f < option_field_count; ++f) {
+            const double* values = values_.data() + f * cells + i * columns;
+            const auto [low, high] = std::minmax_element(values, values + columns);
+            row_ranges_[i * option_field_count + f] = SurfaceRange{.min = *low, .max = *high};
+        }
+    };
+
+    // Rows are handed out one at a time so uneven rows balance across workers
+    if (!workers_) {
+        workers_ = std::make_unique<WorkerPool>(num_threads_, "Surface worker");
+    }
+    std::atomic<std::size_t> next{0};
+    workers_->run([&](unsigned) {
+        for (std::size_t i = next++; i < rows; i = next++) {
+            price_row(i);
+        }
+    });
+
+    for (std::size_t f = 0; f < option_field_count; ++f) {
+        SurfaceRange total{.min = std::numeric_limits<double>::infinity(),
+                           .max = -std::numeric_limits<double>::infinity()};
+        for (std::size_t i = 0; i < rows; ++i) {
+            const SurfaceRange& row = row_ranges_[i * option_field_count + f];
+            total.min = std::min(total.min, row.min);
+            total.max = std::max(total.max, row.max);
+        }
+        ranges_[f] = total;
+    }
+}
+
+} // namespace BlackScholes
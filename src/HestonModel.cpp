@@ -0,0 +1,191 @@
+#include "HestonModel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+namespace {
+
+using Complex = std::complex<double>;
+
+/**
+ * @brief Cosine-series coefficients of e^y over [c, d] within the range [a, b]
+ */
+double chi(int k, double a, double b, double c, double d) noexcept {
+    const double w = k * std::numbers::pi / (b - a);
+    const double ed = std::exp(d);
+    const double ec = std::exp(c);
+    return (std::cos(w * (d - a)) * ed - std::cos(w * (c - a)) * ec
+          + w * std::sin(w * (d - a)) * ed - w * std::sin(w * (c - a)) * ec)
+         / (1.0 + w * w);
+}
+
+/**
+ * @brief Cosine-series coefficients of 1 over [c, d] within the range [a, b]
+ */
+double psi(int k, double a, double b, double c, double d) noexcept {
+    if (k == 0) {
+        return d - c;
+    }
+    const double w = k * std::numbers::pi / (b - a);
+    return (std::sin(w * (d - a)) - std::sin(w * (c - a))) / w;
+}
+
+} // namespace
+
+bool HestonParameters::is_valid() const noexcept {
+    return kappa > 0.0 && theta > 0.0 && vol_of_vol > 0.0 && initial_variance > 0.0
+        && rho > -1.0 && rho < 1.0
+        && std::isfinite(kappa) && std::isfinite(theta)
+        && std::isfinite(vol_of_vol) && std::isfinite(initial_variance);
+}
+
+HestonCosPricer::HestonCosPricer(const HestonParameters& params, int num_terms, double truncation)
+    : params_(params)
+    , num_terms_(num_terms)
+    , truncation_(truncation)
+{
+    if (!params_.is_valid()) {
+        throw std::invalid_argument("Invalid Heston parameters");
+    }
+    if (num_terms_ < 2 || !(truncation_ > 0.0)) {
+        throw std::invalid_argument("Invalid COS expansion settings");
+    }
+}
+
+Complex HestonCosPricer::characteristic_function(Complex u, double T, double carry) const noexcept {
+    const double kappa = params_.kappa;
+    const double theta = params_.theta;
+    const double xi = params_.vol_of_vol;
+    const double rho = params_.rho;
+    const Complex i(0.0, 1.0);
+
+    // Albrecher et al. "little trap" form, continuous in u for all T
+    const Complex beta = kappa - rho * xi * i * u;
+    const Complex d = std::sqrt(beta * beta + xi * xi * (i * u + u * u));
+    const Complex g = (beta - d) / (beta + d);
+    const Complex e = std::exp(-d * T);
+
+    const Complex C = carry * i * u * T
+                    + kappa * theta / (xi * xi) * ((beta - d) * T - 2.0 * std::log((1.0 - g * e) / (1.0 - g)));
+    const Complex D = (beta - d) / (xi * xi) * (1.0 - e) / (1.0 - g * e);
+
+    return std::exp(C + D * params_.initial_variance);
+}
+
+void HestonCosPricer::price_slice(const OptionParameters& base,
+                                  std::span<const double> strikes,
+                                  std::span<double> calls,
+                                  std::span<double> puts,
+                                  std::pmr::memory_resource* resource) const {
+    if (!base.is_valid()) {
+        throw std::invalid_argument("Invalid parameters for Heston calculation");
+    }
+    if (calls.size() != strikes.size() || puts.size() != strikes.size()) {
+        throw std::invalid_argument("Mismatched Heston slice sizes");
+    }
+    if (strikes.empty()) {
+        return;
+    }
+
+    const double S = base.underlying_price;
+    const double T = base.time_to_expiration;
+    const double r = base.risk_free_rate;
+    const double q = base.dividend_yield;
+    const double carry = r - q;
+    const std::size_t n = strikes.size();
+
+    // Log-moneyness x = ln(S/K) per strike
+    std::pmr::vector<double> x(n, resource);
+    double x_min = 0.0;
+    double x_max = 0.0;
+    for (std::size_t j = 0; j < n; ++j) {
+        if (!(strikes[j] > 0.0) || !std::isfinite(strikes[j])) {
+            throw std::invalid_argument("Heston strikes must be positive");
+        }
+        x[j] = std::log(S / strikes[j]);
+        x_min = j == 0 ? x[j] : std::min(x_min, x[j]);
+        x_max = j == 0 ? x[j] : std::max(x_max, x[j]);
+    }
+
+    // Cumulants of ln(S_T/S_0) from the cumulant generating function ln φ(u):
+    // Im ln φ(h) ≈ c1·h, Re ln φ(h) ≈ -c2·h²/2 + c4·h⁴/24
+    constexpr double h = 1e-2;
+    const Complex log_phi_h = std::log(characteristic_function(h, T, carry));
+    const double re_h = log_phi_h.real();
+    const double re_2h = std::log(characteristic_function(2.0 * h, T, carry)).real();
+    const double c1 = log_phi_h.imag() / h;
+    const double c2 = std::max(-(16.0 * re_h - re_2h) / (6.0 * h * h), 1e-12);
+    const double c4 = 2.0 * (re_2h - 4.0 * re_h) / (h * h * h * h);
+
+    // One truncation range covering the density of ln(S_T/K) for every strike
+    const double half_width = truncation_ * std::sqrt(c2 + std::sqrt(std::abs(c4)));
+    const double a = c1 + x_min - half_width;
+    const double b = c1 + x_max + half_width;
+    const double put_upper = std::clamp(0.0, a, b);
+
+    // Per-expiry weights: φ(u_k)·V_k, shared by every strike
+    const int N = num_terms_;
+    const double scale = 2.0 / (b - a);
+    std::pmr::vector<double> weight_re(static_cast<std::size_t>(N), resource);
+    std::pmr::vector<double> weight_im(static_cast<std::size_t>(N), resource);
+    for (int k = 0; k < N; ++k) {
+        const double u = k * std::numbers::pi / (b - a);
+        const double payoff = scale * (psi(k, a, b, a, put_upper) - chi(k, a, b, a, put_upper));
+        const Complex w = characteristic_function(u, T, carry) * (k == 0 ? 0.5 * payoff : payoff);
+        weight_re[static_cast<std::size_t>(k)] = w.real();
+        weight_im[static_cast<std::size_t>(k)] = w.imag();
+    }
+
+    // e^{i·u_k·(x - a)} is advanced by a per-strike rotation instead of trig calls
+    std::pmr::vector<double> phase_re(n, 1.0, resource);
+    std::pmr::vector<double> phase_im(n, 0.0, resource);
+    std::pmr::vector<double> step_re(n, resource);
+    std::pmr::vector<double> step_im(n, resource);
+    std::pmr::vector<double> sum(n, 0.0, resource);
+    const double u1 = std::numbers::pi / (b - a);
+    for (std::size_t j = 0; j < n; ++j) {
+        step_re[j] = std::cos(u1 * (x[j] - a));
+        step_im[j] = std::sin(u1 * (x[j] - a));
+    }
+
+    for (int k = 0; k < N; ++k) {
+        const double w_re = weight_re[static_cast<std::size_t>(k)];
+        const double w_im = weight_im[static_cast<std::size_t>(k)];
+        for (std::size_t j = 0; j < n; ++j) {
+            sum[j] += w_re * phase_re[j] - w_im * phase_im[j];
+            const double re = phase_re[j] * step_re[j] - phase_im[j] * step_im[j];
+            phase_im[j] = phase_re[j] * step_im[j] + phase_im[j] * step_re[j];
+            phase_re[j] = re;
+        }
+    }
+
+    const double discount_factor = std::exp(-r * T);
+    const double forward_value = S * std::exp(-q * T);
+    for (std::size_t j = 0; j < n; ++j) {
+        const double K_discount = strikes[j] * discount_factor;
+        const double put = std::max(0.0, K_discount * sum[j]);
+        puts[j] = put;
+        calls[j] = std::max(0.0, put + forward_value - K_discount); // Put-call parity
+    }
+}
+
+double HestonCosPricer::call_price(const OptionParameters& params) const {
+    const double strike = params.strike_price;
+    double call = 0.0;
+    double put = 0.0;
+    price_slice(params, std::span<const double>(&strike, 1), std::span<double>(&call, 1), std::span<double>(&put, 1));
+    return call;
+}
+
+double HestonCosPricer::put_price(const OptionParameters& params) const {
+    const double strike = params.strike_price;
+    double call = 0.0;
+    double put = 0.0;
+    price_slice(params, std::span<const double>(&strike, 1), std::span<double>(&call, 1), std::span<double>(&put, 1));
+    return put;
+}
+
+} // namespace BlackScholes
@@ -0,0 +1,129 @@
+#include "IncrementalEngine.hpp"
+#include "PricingKernel.hpp"
+#include <stdexcept>
+
+namespace BlackScholes {
+
+IncrementalEngine::PositionId IncrementalEngine::add_position(const std::string& underlying,
+                                                              const std::string& curve,
+                                                              const OptionParameters& params) {
+    if (!params.is_valid()) {
+        throw std::invalid_argument("Invalid parameters for incremental position");
+    }
+
+    const PositionId id = params_.size();
+    const CachedTerms terms = make_terms(params);
+
+    params_.push_back(params);
+    terms_.push_back(terms);
+    prices_.push_back(price_row(params, terms, std::log(params.underlying_price)));
+    by_underlying_[underlying].push_back(id);
+    by_curve_[curve].push_back(id);
+
+    return id;
+}
+
+std::span<const IncrementalEngine::PositionId>
+IncrementalEngine::update_spot(const std::string& underlying, double spot) {
+    if (!(spot > 0.0) || !std::isfinite(spot)) {
+        throw std::invalid_argument("Invalid spot for incremental update");
+    }
+
+    const auto it = by_underlying_.find(underlying);
+    if (it == by_underlying_.end()) {
+        return {};
+    }
+
+    // ln(S) is shared by every position on this underlying
+    const double log_S = std::log(spot);
+    for (const PositionId id : it->second) {
+        params_[id].underlying_price = spot;
+        prices_[id] = price_row(params_[id], terms_[id], log_S);
+    }
+
+    return it->second;
+}
+
+std::span<const IncrementalEngine::PositionId>
+IncrementalEngine::update_rate(const std::string& curve, double rate) {
+    if (!std::isfinite(rate)) {
+        throw std::invalid_argument("Invalid rate for incremental update");
+    }
+
+    const auto it = by_curve_.find(curve);
+    if (it == by_curve_.end()) {
+        return {};
+    }
+
+    for (const PositionId id : it->second) {
+        OptionParameters& params = params_[id];
+        params.risk_free_rate = rate;
+        terms_[id] = make_terms(params);
+        prices_[id] = price_row(params, terms_[id], std::log(params.underlying_price));
+    }
+
+    return it->second;
+}
+
+void IncrementalEngine::update_volatility(PositionId id, double sigma) {
+    if (!(sigma > 0.0) || !std::isfinite(sigma)) {
+        throw std::invalid_argument("Invalid volatility for incremental update");
+    }
+
+    OptionParameters& params = params_.at(id);
+    params.volatility = sigma;
+    terms_[id] = make_terms(params);
+    prices_[id] = price_row(params, terms_[id], std::log(params.underlying_price));
+}
+
+IncrementalEngine::CachedTerms IncrementalEngine::make_terms(const OptionParameters& params) noexcept {
+    const double T = params.time_to_expiration;
+    const double sigma = params.volatility;
+    const double sqrt_T = std::sqrt(T);
+
+    return CachedTerms{
+        .log_strike = std::log(params.strike_price),
+        .discounted_strike = params.strike_price * std::exp(-params.risk_free_rate * T),
+        .dividend_factor = std::exp(-params.dividend_yield * T),
+        .sqrt_T = sqrt_T,
+        .sigma_sqrt_T = sigma * sqrt_T,
+        .drift_T = (params.risk_free_rate - params.dividend_yield + 0.5 * sigma * sigma) * T
+    };
+}
+
+OptionPrices IncrementalEngine::price_row(const OptionParameters& params,
+                                          const CachedTerms& terms,
+                                          double log_S) noexcept {
+    const double S = params.underlying_price;
+    const double T = params.time_to_expiration;
+    const double r = params.risk_free_rate;
+    const double q = params.dividend_yield;
+    const double sigma = params.volatility;
+
+    const double d1 = (log_S - terms.log_strike + terms.drift_T) / terms.sigma_sqrt_T;
+    const double d2 = d1 - terms.sigma_sqrt_T;
+
+    const auto [N_d1, N_neg_d1, phi_d1] = Kernel::normal_tails(d1);
+    const Kernel::NormalTails tails_d2 = Kernel::normal_tails(d2);
+    const double N_d2 = tails_d2.lower;
+    const double N_neg_d2 = tails_d2.upper;
+
+    const double DK = terms.discounted_strike;
+    const double Sq = S * terms.dividend_factor;
+    const double time_decay = -(Sq * phi_d1 * sigma) / (2.0 * terms.sqrt_T);
+
+    return OptionPrices{
+        .call_price = Sq * N_d1 - DK * N_d2,
+        .put_price = DK * N_neg_d2 - Sq * N_neg_d1,
+        .delta_call = terms.dividend_factor * N_d1,
+        .delta_put = -terms.dividend_factor * N_neg_d1,
+        .gamma = terms.dividend_factor * phi_d1 / (S * terms.sigma_sqrt_T),
+        .theta_call = (time_decay + q * Sq * N_d1 - r * DK * N_d2) / 365.25,      // Per day
+        .theta_put = (time_decay - q * Sq * N_neg_d1 + r * DK * N_neg_d2) / 365.25, // Per day
+        .vega = Sq * phi_d1 * terms.sqrt_T / 100.0,                                // Per 1% volatility change
+        .rho_call = T * DK * N_d2 / 100.0,                      // Per 1% rate change
+        .rho_put = -T * DK * N_neg_d2 / 100.0                   // Per 1% rate change
+    };
+}
+
+} // namespace BlackScholes
@@ -0,0 +1,433 @@
+#include "Instrumentation.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace BlackScholes::Instrumentation {
+
+std::string_view probe_name(Probe probe) noexcept {
+    switch (probe) {
+        case Probe::CalculatePrices: return "calculate_prices";
+        case Probe::PriceCurve: return "price_curve";
+        case Probe::BatchPricing: return "batch_pricing";
+        case Probe::BatchValidation: return "batch_validation";
+        case Probe::VaRRun: return "var_run";
+        case Probe::Calibration: return "calibration";
+        case Probe::SurfaceGrid: return "surface_grid";
+        case Probe::CurveRefine: return "curve_refine";
+        case Probe::GuiFrame: return "gui_frame";
+        case Probe::GuiCalculate: return "gui_calculate";
+        case Probe::GuiPlotUpdate: return "gui_plot_update";
+        case Probe::GuiPlotRender: return "gui_plot_render";
+        case Probe::Count: break;
+    }
+    return "unknown";
+}
+
+// LatencyHistogram implementation
+std::size_t LatencyHistogram::bucket_index(std::uint64_t nanoseconds) noexcept {
+    if (nanoseconds < sub_buckets) {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+    const int exponent = std::bit_width(nanoseconds) - 1;
+    if (exponent >= max_exponent) {
+        return bucket_count - 1;
+    }
+    const int shift = exponent - sub_bucket_bits;
+    const std::size_t sub_bucket = static_cast<std::size_t>(nanoseconds >> shift) & (sub_buckets - 1);
+    return (static_cast<std::size_t>(exponent - sub_bucket_bits + 1) << sub_bucket_bits) + sub_bucket;
+}
+
+std::uint64_t LatencyHistogram::bucket_upper_bound(std::size_t index) noexcept {
+    if (index < sub_buckets) {
+        return index + 1;
+    }
+    const int shift = static_cast<int>(index >> sub_bucket_bits) - 1;
+    const std::uint64_t sub_bucket = index & (sub_buckets - 1);
+    return (sub_buckets + sub_bucket + 1) << shift;
+}
+
+void LatencyHistogram::record(std::uint64_t nanoseconds, std::uint64_t items) noexcept {
+    ++buckets_[bucket_index(nanoseconds)];
+    ++count_;
+    items_ += items;
+    total_ns_ += nanoseconds;
+    min_ns_ = std::min(min_ns_, nanoseconds);
+    max_ns_ = std::max(max_ns_, nanoseconds);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) noexcept {
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    items_ += other.items_;
+    total_ns_ += other.total_ns_;
+    min_ns_ = std::min(min_ns_, other.min_ns_);
+    max_ns_ = std::max(max_ns_, other.max_ns_);
+}
+
+std::uint64_t LatencyHistogram::value_at_quantile(double quantile) const noexcept {
+    if (count_ == 0) {
+        return 0;
+    }
+    const double clamped = std::clamp(quantile, 0.0, 1.0);
+    const auto rank = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(clamped * static_cast<double>(count_))));
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+        seen += buckets_[i];
+        if (seen >= rank) {
+            return std::min(bucket_upper_bound(i), max_ns_);
+        }
+    }
+    return max_ns_;
+}
+
+std::uint64_t LatencyHistogram::count_below(std::uint64_t upper_ns) const noexcept {
+    std::uint64_t below = 0;
+    for (std::size_t i = 0; i < bucket_count && bucket_upper_bound(i) <= upper_ns; ++i) {
+        below += buckets_[i];
+    }
+    return below;
+}
+
+/**
+ * @brief One thread's histograms, readable by other threads while being written
+ *
+ * Only the owning thread writes, so updates are a relaxed load and store
+ * rather than an atomic read-modify-write.
+ */
+class Recorder {
+public:
+    void record(Probe probe, std::uint64_t nanoseconds, std::uint64_t items) noexcept {
+        Slot& slot = slots_[static_cast<std::size_t>(probe)];
+        bump(slot.buckets[LatencyHistogram::bucket_index(nanoseconds)], 1);
+        bump(slot.count, 1);
+        bump(slot.items, items);
+        bump(slot.total_ns, nanoseconds);
+        if (nanoseconds < slot.min_ns.load(std::memory_order_relaxed)) {
+            slot.min_ns.store(nanoseconds, std::memory_order_relaxed);
+        }
+        if (nanoseconds > slot.max_ns.load(std::memory_order_relaxed)) {
+            slot.max_ns.store(nanoseconds, std::memory_order_relaxed);
+        }
+    }
+
+    void merge_into(Snapshot& snapshot) const noexcept {
+        for (std::size_t p = 0; p < probe_count; ++p) {
+            const Slot& slot = slots_[p];
+            LatencyHistogram& h = snapshot.histograms[p];
+            for (std::size_t i = 0; i < LatencyHistogram::bucket_count; ++i) {
+                h.buckets_[i] += slot.buckets[i].load(std::memory_order_relaxed);
+            }
+            h.count_ += slot.count.load(std::memory_order_relaxed);
+            h.items_ += slot.items.load(std::memory_order_relaxed);
+            h.total_ns_ += slot.total_ns.load(std::memory_order_relaxed);
+            h.min_ns_ = std::min(h.min_ns_, slot.min_ns.load(std::memory_order_relaxed));
+            h.max_ns_ = std::max(h.max_ns_, slot.max_ns.load(std::memory_order_relaxed));
+        }
+    }
+
+    void clear() noexcept {
+        for (Slot& slot : slots_) {
+            for (auto& bucket : slot.buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            slot.count.store(0, std::memory_order_relaxed);
+            slot.items.store(0, std::memory_order_relaxed);
+            slot.total_ns.store(0, std::memory_order_relaxed);
+            slot.min_ns.store(UINT64_MAX, std::memory_order_relaxed);
+            slot.max_ns.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct Slot {
+        std::array<std::atomic<std::uint64_t>, LatencyHistogram::bucket_count> buckets{};
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> items{0};
+        std::atomic<std::uint64_t> total_ns{0};
+        std::atomic<std::uint64_t> min_ns{UINT64_MAX};
+        std::atomic<std::uint64_t> max_ns{0};
+    };
+
+    std::array<Slot, probe_count> slots_{};
+
+    static void bump(std::atomic<std::uint64_t>& counter, std::uint64_t amount) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+};
+
+namespace {
+
+/**
+ * @brief Live recorders plus the folded-in totals of exited threads
+ */
+class Registry {
+public:
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    Recorder* attach() {
+        auto recorder = std::make_unique<Recorder>();
+        Recorder* raw = recorder.get();
+        const std::lock_guard lock(mutex_);
+        live_.push_back(std::move(recorder));
+        return raw;
+    }
+
+    void detach(Recorder* recorder) noexcept {
+        const std::lock_guard lock(mutex_);
+        const auto it = std::find_if(live_.begin(), live_.end(),
+                                     [recorder](const auto& r) { return r.get() == recorder; });
+        if (it != live_.end()) {
+            (*it)->merge_into(retired_);
+            live_.erase(it);
+        }
+    }
+
+    Snapshot snapshot() {
+        const std::lock_guard lock(mutex_);
+        Snapshot merged = retired_;
+        for (const auto& recorder : live_) {
+            recorder->merge_into(merged);
+        }
+        return merged;
+    }
+
+    void reset() noexcept {
+        const std::lock_guard lock(mutex_);
+        retired_ = Snapshot{};
+        for (const auto& recorder : live_) {
+            recorder->clear();
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Recorder>> live_;
+    Snapshot retired_{};
+};
+
+/**
+ * @brief Registers the thread's recorder on first use and folds it in on thread exit
+ */
+struct ThreadRecorder {
+    Recorder* recorder = Registry::instance().attach();
+    ~ThreadRecorder() { Registry::instance().detach(recorder); }
+};
+
+void write_quantity(std::ostream& out, std::string_view metric, Probe probe,
+                    std::string_view extra_label, double value) {
+    out << metric << "{probe=\"" << probe_name(probe) << '"' << extra_label << "} " << value << '\n';
+}
+
+} // namespace
+
+void record(Probe probe, std::uint64_t nanoseconds, std::uint64_t items) noexcept {
+    thread_local ThreadRecorder local;
+    local.recorder->record(probe, nanoseconds, items);
+}
+
+Snapshot snapshot() {
+    return Registry::instance().snapshot();
+}
+
+void reset() noexcept {
+    Registry::instance().reset();
+}
+
+void write_prometheus(std::ostream& out, const Snapshot& snapshot) {
+    constexpr double ns_to_seconds = 1e-9;
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::setprecision(9);
+
+    out << "# HELP blackscholes_latency_seconds Wall-clock latency of instrumented calls\n"
+        << "# TYPE blackscholes_latency_seconds histogram\n";
+    for (std::size_t p = 0; p < probe_count; ++p) {
+        const Probe probe = static_cast<Probe>(p);
+        const LatencyHistogram& h = snapshot.histograms[p];
+        if (h.count() == 0) {
+            continue;
+        }
+        // Power-of-four edges from 64 ns to 2^36 ns coincide with bucket edges
+        for (int exponent = 6; exponent <= 36; exponent += 2) {
+            const std::uint64_t edge = std::uint64_t{1} << exponent;
+            std::ostringstream le;
+            le << std::setprecision(9) << ",le=\"" << static_cast<double>(edge) * ns_to_seconds << '"';
+            write_quantity(out, "blackscholes_latency_seconds_bucket", probe, le.str(),
+                           static_cast<double>(h.count_below(edge)));
+        }
+        write_quantity(out, "blackscholes_latency_seconds_bucket", probe, ",le=\"+Inf\"",
+                       static_cast<double>(h.count()));
+        write_quantity(out, "blackscholes_latency_seconds_sum", probe, "",
+                       static_cast<double>(h.total_ns()) * ns_to_seconds);
+        write_quantity(out, "blackscholes_latency_seconds_count", probe, "", static_cast<double>(h.count()));
+    }
+
+    out << "# HELP blackscholes_latency_quantile_seconds Latency quantiles from the HDR histograms\n"
+        << "# TYPE blackscholes_latency_quantile_seconds gauge\n";
+    constexpr std::array<std::pair<double, std::string_view>, 4> quantiles{{
+        {0.5, ",quantile=\"0.5\""}, {0.9, ",quantile=\"0.9\""},
+        {0.99, ",quantile=\"0.99\""}, {0.999, ",quantile=\"0.999\""}
+    }};
+    for (std::size_t p = 0; p < probe_count; ++p) {
+        const LatencyHistogram& h = snapshot.histograms[p];
+        if (h.count() == 0) {
+            continue;
+        }
+        for (const auto& [q, label] : quantiles) {
+            write_quantity(out, "blackscholes_latency_quantile_seconds", static_cast<Probe>(p), label,
+                           static_cast<double>(h.value_at_quantile(q)) * ns_to_seconds);
+        }
+    }
+
+    out << "# HELP blackscholes_items_total Rows, points or scenarios processed by instrumented calls\n"
+        << "# TYPE blackscholes_items_total counter\n";
+    for (std::size_t p = 0; p < probe_count; ++p) {
+        const LatencyHistogram& h = snapshot.histograms[p];
+        if (h.count() == 0) {
+            continue;
+        }
+        write_quantity(out, "blackscholes_items_total", static_cast<Probe>(p), "", static_cast<double>(h.items()));
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+void export_prometheus(const std::string& path) {
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Cannot open metrics file: " + temp_path);
+        }
+        write_prometheus(file, snapshot());
+        if (!file.flush()) {
+            throw std::runtime_error("Cannot write metrics file: " + temp_path);
+        }
+    }
+    // Unlike std::rename, replaces an existing file on Windows too
+    std::error_code error;
+    std::filesystem::rename(temp_path, path, error);
+    if (error) {
+        throw std::runtime_error("Cannot replace metrics file: " + path + " (" + error.message() + ")");
+    }
+}
+
+// MetricsServer implementation
+#if defined(_WIN32)
+
+MetricsServer::MetricsServer(std::uint16_t) {
+    throw std::runtime_error("MetricsServer is not supported on this platform");
+}
+
+MetricsServer::~MetricsServer() = default;
+
+void MetricsServer::serve(std::stop_token) {}
+
+#else
+
+MetricsServer::MetricsServer(std::uint16_t port) {
+    listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd_ < 0) {
+        throw std::runtime_error("Cannot open metrics socket");
+    }
+
+    const int reuse = 1;
+    ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+        || ::listen(listen_fd_, 8) != 0
+        || ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        ::close(listen_fd_);
+        throw std::runtime_error("Cannot bind metrics socket to port " + std::to_string(port));
+    }
+    port_ = ntohs(address.sin_port);
+
+    worker_ = std::jthread([this](std::stop_token stop) { serve(stop); });
+}
+
+MetricsServer::~MetricsServer() {
+    worker_.request_stop();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    ::close(listen_fd_);
+}
+
+void MetricsServer::serve(std::stop_token stop) {
+    while (!stop.stop_requested()) {
+        // Wake periodically to notice a stop request
+        pollfd listener{listen_fd_, POLLIN, 0};
+        if (::poll(&listener, 1, 200) <= 0) {
+            continue;
+        }
+        const int client = ::accept(listen_fd_, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+
+        // The request itself is irrelevant; drain what has arrived so the close is clean
+        pollfd request{client, POLLIN, 0};
+        if (::poll(&request, 1, 200) > 0) {
+            char discard[1024];
+            [[maybe_unused]] const auto ignored = ::recv(client, discard, sizeof(discard), 0);
+        }
+
+        std::ostringstream body;
+        write_prometheus(body, snapshot());
+        const std::string payload = body.str();
+        const std::string response = "HTTP/1.0 200 OK\r\n"
+                                     "Content-Type: text/plain; version=0.0.4\r\n"
+                                     "Content-Length: " + std::to_string(payload.size()) + "\r\n"
+                                     "Connection: close\r\n\r\n" + payload;
+
+#if defined(MSG_NOSIGNAL)
+        constexpr int send_flags = MSG_NOSIGNAL;
+#else
+        constexpr int send_flags = 0;
+#endif
+        std::size_t sent = 0;
+        while (sent < response.size()) {
+            const auto n = ::send(client, response.data() + sent, response.size() - sent, send_flags);
+            if (n <= 0) {
+                break;
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+        ::close(client);
+    }
+}
+
+#endif
+
+} // namespace BlackScholes::Instrumentation
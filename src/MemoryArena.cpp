@@ -0,0 +1,109 @@
+#include "MemoryArena.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace BlackScholes {
+
+namespace {
+
+constexpr std::size_t block_alignment = alignof(std::max_align_t);
+
+constexpr std::size_t align_up(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+// CountingResource implementation
+void CountingResource::reset_counts() noexcept {
+    allocations_.store(0, std::memory_order_relaxed);
+    deallocations_.store(0, std::memory_order_relaxed);
+    bytes_allocated_.store(0, std::memory_order_relaxed);
+}
+
+void* CountingResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    void* p = upstream_->allocate(bytes, alignment);
+    allocations_.fetch_add(1, std::memory_order_relaxed);
+    bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+    bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed);
+    return p;
+}
+
+void CountingResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+    upstream_->deallocate(p, bytes, alignment);
+    deallocations_.fetch_add(1, std::memory_order_relaxed);
+    bytes_in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+bool CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+// ScratchArena implementation
+ScratchArena::ScratchArena(std::size_t initial_bytes, std::pmr::memory_resource* upstream)
+    : upstream_(upstream)
+    , capacity_(align_up(std::max<std::size_t>(initial_bytes, block_alignment), block_alignment))
+{
+    block_ = static_cast<std::byte*>(upstream_->allocate(capacity_, block_alignment));
+}
+
+ScratchArena::~ScratchArena() {
+    release_spills();
+    if (block_ != nullptr) {
+        upstream_->deallocate(block_, capacity_, block_alignment);
+    }
+}
+
+void ScratchArena::reset() {
+    const std::size_t total = used();
+    high_water_ = std::max(high_water_, total);
+
+    // Grow the retained block once so the next cycle of this size fits in it
+    const bool spilled = spills_ != nullptr;
+    release_spills();
+    if (spilled) {
+        const std::size_t grown = std::bit_ceil(total);
+        upstream_->deallocate(block_, capacity_, block_alignment);
+        block_ = nullptr;
+        capacity_ = 0;
+        block_ = static_cast<std::byte*>(upstream_->allocate(grown, block_alignment));
+        capacity_ = grown;
+    }
+    used_ = 0;
+}
+
+void ScratchArena::release_spills() noexcept {
+    while (spills_ != nullptr) {
+        Spill* next = spills_->next;
+        upstream_->deallocate(spills_, spills_->bytes, spills_->alignment);
+        spills_ = next;
+    }
+    spilled_bytes_ = 0;
+}
+
+void* ScratchArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    // Fast path: bump through the retained block
+    const auto base = reinterpret_cast<std::uintptr_t>(block_);
+    const std::size_t offset = align_up(base + used_, alignment) - base;
+    if (offset + bytes <= capacity_) {
+        used_ = offset + bytes;
+        return block_ + offset;
+    }
+
+    // Spill to upstream with a header that chains the spill for reset()
+    const std::size_t spill_alignment = std::max(alignment, alignof(Spill));
+    const std::size_t header = align_up(sizeof(Spill), spill_alignment);
+    const std::size_t total = header + bytes;
+    auto* spill = static_cast<Spill*>(upstream_->allocate(total, spill_alignment));
+    *spill = Spill{spills_, total, spill_alignment};
+    spills_ = spill;
+    spilled_bytes_ += bytes + (alignment - 1);
+    return reinterpret_cast<std::byte*>(spill) + header;
+}
+
+bool ScratchArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+} // namespace BlackScholes
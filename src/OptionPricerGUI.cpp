@@ -1,4 +1,6 @@
 #include "OptionPricerGUI.hpp"
+#include "Instrumentation.hpp"
+#include "TraceEvents.hpp"
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
@@ -6,18 +8,86 @@
 #include <GLFW/glfw3.h>
 #include <stdexcept>
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
+#include <chrono>
+#include <cstdio>
+#include <span>
 
 namespace GUI {
 
+namespace Instrumentation = BlackScholes::Instrumentation;
+namespace Tracing = BlackScholes::Tracing;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Adds the lifetime of a scope to a millisecond total
+ */
+class StageTimer {
+public:
+    explicit StageTimer(double& total_ms) noexcept : total_ms_(total_ms), start_(Clock::now()) {}
+    ~StageTimer() { total_ms_ += elapsed_ms(start_); }
+
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+private:
+    double& total_ms_;
+    Clock::time_point start_;
+};
+
+/**
+ * @brief Append to a fixed oldest-first history, dropping the oldest entry
+ */
+void push_history(std::array<float, FrameStats::history_size>& history, float value) {
+    std::copy(history.begin() + 1, history.end(), history.begin());
+    history.back() = value;
+}
+
+} // namespace
+
+// FrameStats implementation
+void FrameStats::begin_frame(float frame_interval_ms, std::size_t allocations) noexcept {
+    push_history(frame_ms, frame_interval_ms);
+    push_history(render_ms, static_cast<float>(frame_render_ms));
+    history_count = std::min(history_count + 1, history_size);
+
+    last_calculate_ms = calculate_ms;
+    last_plot_build_ms = plot_build_ms;
+    last_plot_render_ms = plot_render_ms;
+    last_render_ms = frame_render_ms;
+    last_allocations = allocations - allocation_mark;
+    allocation_mark = allocations;
+
+    calculate_ms = 0.0;
+    plot_build_ms = 0.0;
+    plot_render_ms = 0.0;
+    frame_render_ms = 0.0;
+}
+
 // OptionPricerGUI implementation
 OptionPricerGUI::OptionPricerGUI() {
     setup_style();
-    update_calculations();
+    update_model();
 }
 
 void OptionPricerGUI::render() {
+    const Instrumentation::ScopedTimer frame_timer(Instrumentation::Probe::GuiFrame);
+    const Tracing::TraceSpan frame_span("OptionPricerGUI::render", "gui");
+    frame_stats_.begin_frame(ImGui::GetIO().DeltaTime * 1000.0f, heap_counter_.allocations());
+    const StageTimer render_timer(frame_stats_.frame_render_ms);
+    
+    // Last frame's scratch is dead by now
+    frame_arena_.reset();
+    
+    // All computation happens here; everything below only draws
+    update_model();
+    
     // Main menu bar
     if (ImGui::BeginMainMenuBar()) {
         if (ImGui::BeginMenu("File")) {
@@ -29,6 +99,7 @@ void OptionPricerGUI::render() {
         
         if (ImGui::BeginMenu("View")) {
             ImGui::MenuItem("Show Greeks", nullptr, &show_greeks_);
+            ImGui::MenuItem("Show Performance", nullptr, &show_performance_overlay_);
             ImGui::MenuItem("Show Demo", nullptr, &show_demo_window_);
             ImGui::EndMenu();
         }
@@ -66,6 +137,11 @@ void OptionPricerGUI::render() {
         // ImPlot::ShowDemoWindow(&show_demo_window_); // Not available in this ImPlot version
     }
     
+    // Performance overlay
+    if (show_performance_overlay_) {
+        render_performance_overlay();
+    }
+    
     // Main application layout
     const ImGuiViewport* viewport = ImGui::GetMainViewport();
     ImGui::SetNextWindowPos(viewport->WorkPos);
@@ -104,14 +180,15 @@ void OptionPricerGUI::render_parameter_panel() {
     ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Option Parameters");
     ImGui::Separator();
     
+    PricerInputs& inputs = model_.inputs();
     bool params_changed = false;
     
     // Underlying Price (S)
     ImGui::Text("Underlying Price (S)");
     ImGui::SameLine();
     show_help_marker("Current price of the underlying asset");
-    if (ImGui::InputFloat("##underlying", &underlying_price_, 0.1f, 1.0f, "%.2f")) {
-        underlying_price_ = std::max(0.01f, underlying_price_);
+    if (ImGui::InputFloat("##underlying", &inputs.underlying_price, 0.1f, 1.0f, "%.2f")) {
+        inputs.underlying_price = std::max(0.01f, inputs.underlying_price);
         params_changed = true;
     }
     
@@ -119,8 +196,8 @@ void OptionPricerGUI::render_parameter_panel() {
     ImGui::Text("Strike Price (K)");
     ImGui::SameLine();
     show_help_marker("Exercise price of the option");
-    if (ImGui::InputFloat("##strike", &strike_price_, 0.1f, 1.0f, "%.2f")) {
-        strike_price_ = std::max(0.01f, strike_price_);
+    if (ImGui::InputFloat("##strike", &inputs.strike_price, 0.1f, 1.0f, "%.2f")) {
+        inputs.strike_price = std::max(0.01f, inputs.strike_price);
         params_changed = true;
     }
     
@@ -128,8 +205,8 @@ void OptionPricerGUI::render_parameter_panel() {
     ImGui::Text("Time to Expiration (T)");
     ImGui::SameLine();
     show_help_marker("Time until expiration in years (e.g., 0.25 for 3 months)");
-    if (ImGui::InputFloat("##time", &time_to_expiration_, 0.01f, 0.1f, "%.3f")) {
-        time_to_expiration_ = std::max(0.001f, time_to_expiration_);
+    if (ImGui::InputFloat("##time", &inputs.time_to_expiration, 0.01f, 0.1f, "%.3f")) {
+        inputs.time_to_expiration = std::max(0.001f, inputs.time_to_expiration);
         params_changed = true;
     }
     
@@ -137,7 +214,7 @@ void OptionPricerGUI::render_parameter_panel() {
     ImGui::Text("Risk-free Rate (r)");
     ImGui::SameLine();
     show_help_marker("Risk-free interest rate as decimal (e.g., 0.05 for 5%)");
-    if (ImGui::InputFloat("##rate", &risk_free_rate_, 0.001f, 0.01f, "%.4f")) {
+    if (ImGui::InputFloat("##rate", &inputs.risk_free_rate, 0.001f, 0.01f, "%.4f")) {
         params_changed = true;
     }
     
@@ -145,8 +222,8 @@ void OptionPricerGUI::render_parameter_panel() {
     ImGui::Text("Volatility (σ)");
     ImGui::SameLine();
     show_help_marker("Annual volatility as decimal (e.g., 0.2 for 20%)");
-    if (ImGui::InputFloat("##volatility", &volatility_, 0.01f, 0.1f, "%.3f")) {
-        volatility_ = std::max(0.001f, volatility_);
+    if (ImGui::InputFloat("##volatility", &inputs.volatility, 0.01f, 0.1f, "%.3f")) {
+        inputs.volatility = std::max(0.001f, inputs.volatility);
         params_changed = true;
     }
     
@@ -163,7 +240,7 @@ void OptionPricerGUI::render_parameter_panel() {
     
     // Manual calculation button
     if (ImGui::Button("Calculate") || (auto_calculate_ && params_changed)) {
-        update_calculations();
+        model_.invalidate_prices();
     }
     
     // Calculation settings
@@ -171,45 +248,52 @@ void OptionPricerGUI::render_parameter_panel() {
     ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Plot Settings");
     ImGui::Separator();
     
-    if (ImGui::InputFloat("Price Range", &price_range_, 1.0f, 10.0f, "±%.0f")) {
-        price_range_ = std::max(1.0f, price_range_);
+    if (ImGui::InputFloat("Price Range", &inputs.price_range, 1.0f, 10.0f, "±%.0f")) {
+        inputs.price_range = std::max(1.0f, inputs.price_range);
         if (auto_calculate_) {
-            update_plot_data();
+            model_.invalidate_curve();
+            model_.invalidate_surface();
         }
     }
     
-    if (ImGui::InputInt("Plot Points", &num_plot_points_)) {
-        num_plot_points_ = std::clamp(num_plot_points_, 50, 1000);
+    if (ImGui::InputInt("Plot Points", &inputs.plot_points, 100, 10000)) {
+        inputs.plot_points = std::clamp(inputs.plot_points, 50, 1000000);
         if (auto_calculate_) {
-            update_plot_data();
+            model_.invalidate_curve();
         }
     }
+    
+    if (ImGui::InputInt("Surface Points", &inputs.surface_points, 16, 64)) {
+        inputs.surface_points = std::clamp(inputs.surface_points, 16, 512);
+        model_.invalidate_surface();
+    }
+    ImGui::SameLine();
+    show_help_marker("Grid points per axis of the Greeks surface heatmap");
 }
 
 void OptionPricerGUI::render_results_panel() {
     ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Option Prices");
     ImGui::Separator();
     
-    if (!results_valid_) {
+    if (!model_.results_valid()) {
         ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Error:");
-        ImGui::TextWrapped("%s", error_message_.c_str());
+        ImGui::TextWrapped("%s", model_.error_message().c_str());
         return;
     }
+    const BlackScholes::OptionPrices& prices = model_.prices();
     
     // Call Price
     ImGui::TextColored(ImVec4(0.2f, 0.8f, 0.2f, 1.0f), "Call Price:");
     ImGui::SameLine();
-    ImGui::Text("%s", format_currency(current_prices_.call_price).c_str());
+    ImGui::Text("%s", format_currency(prices.call_price, &frame_arena_).c_str());
     
     // Put Price  
     ImGui::TextColored(ImVec4(0.8f, 0.2f, 0.2f, 1.0f), "Put Price:");
     ImGui::SameLine();
-    ImGui::Text("%s", format_currency(current_prices_.put_price).c_str());
+    ImGui::Text("%s", format_currency(prices.put_price, &frame_arena_).c_str());
     
     // Put-Call Parity Check
-    const double parity_lhs = current_prices_.call_price - current_prices_.put_price;
-    const double parity_rhs = underlying_price_ - strike_price_ * std::exp(-risk_free_rate_ * time_to_expiration_);
-    const double parity_diff = std::abs(parity_lhs - parity_rhs);
+    const double parity_diff = model_.parity_difference();
     
     ImGui::Spacing();
     ImGui::Text("Put-Call Parity Check:");
@@ -223,6 +307,27 @@ void OptionPricerGUI::render_results_panel() {
 }
 
 void OptionPricerGUI::render_plot_panel() {
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::GuiPlotRender);
+    const Tracing::TraceSpan span("render_plot_panel", "gui");
+    const StageTimer stage(frame_stats_.plot_render_ms);
+    
+    bool surface_visible = false;
+    if (ImGui::BeginTabBar("PlotTabs")) {
+        if (ImGui::BeginTabItem("Price Curves")) {
+            render_price_curves();
+            ImGui::EndTabItem();
+        }
+        if (ImGui::BeginTabItem("Greeks Surface")) {
+            surface_visible = true;
+            render_surface_panel();
+            ImGui::EndTabItem();
+        }
+        ImGui::EndTabBar();
+    }
+    model_.set_surface_visible(surface_visible);
+}
+
+void OptionPricerGUI::render_price_curves() {
     ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Option Price Visualization");
     ImGui::Separator();
     
@@ -241,30 +346,45 @@ void OptionPricerGUI::render_plot_panel() {
         current_plot_type_ = PlotType::Both;
     }
     
-    if (!results_valid_ || plot_x_data_.empty()) {
+    const BlackScholes::ProgressiveCurve& curve = model_.curve();
+    
+    // A coarse curve stands in until the full resolution arrives
+    if (curve.refining()) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("Refining %zu of %zu points", curve.size(), curve.target_points());
+    }
+    
+    if (!model_.results_valid() || curve.empty()) {
         ImGui::Text("No data to display. Please check parameters and calculate.");
         return;
     }
     
+    const std::span<const double> prices = curve.underlying();
+    const std::uint64_t version = model_.series_version();
+    
     // Main price plot
     if (ImPlot::BeginPlot("Option Prices vs Underlying Price", ImVec2(-1, -150))) {
         ImPlot::SetupAxes("Underlying Price ($)", "Option Price ($)");
-        ImPlot::SetupAxisLimits(ImAxis_X1, plot_x_data_.front(), plot_x_data_.back());
+        ImPlot::SetupAxisLimits(ImAxis_X1, prices.front(), prices.back());
         
         // Current price indicator would go here (commented for compatibility)
-        // const double current_price = static_cast<double>(underlying_price_);
+        // const double current_price = static_cast<double>(model_.inputs().underlying_price);
+        
+        // Locks the axes setup; the decimation follows the visible range
+        const ImPlotRect view = ImPlot::GetPlotLimits();
+        const int width = static_cast<int>(ImPlot::GetPlotSize().x);
         
         // Plot option curves
         if (current_plot_type_ == PlotType::CallPrice || current_plot_type_ == PlotType::Both) {
+            lod_call_.update(prices, curve.call(), version, view.X.Min, view.X.Max, width);
             ImPlot::SetNextLineStyle(ImVec4(0.2f, 0.8f, 0.2f, 1.0f), 2.0f);
-            ImPlot::PlotLine("Call Price", plot_x_data_.data(), plot_call_data_.data(), 
-                           static_cast<int>(plot_x_data_.size()));
+            ImPlot::PlotLine("Call Price", lod_call_.x().data(), lod_call_.y().data(), lod_call_.size());
         }
         
         if (current_plot_type_ == PlotType::PutPrice || current_plot_type_ == PlotType::Both) {
+            lod_put_.update(prices, curve.put(), version, view.X.Min, view.X.Max, width);
             ImPlot::SetNextLineStyle(ImVec4(0.8f, 0.2f, 0.2f, 1.0f), 2.0f);
-            ImPlot::PlotLine("Put Price", plot_x_data_.data(), plot_put_data_.data(), 
-                           static_cast<int>(plot_x_data_.size()));
+            ImPlot::PlotLine("Put Price", lod_put_.x().data(), lod_put_.y().data(), lod_put_.size());
         }
         
         ImPlot::EndPlot();
@@ -273,42 +393,107 @@ void OptionPricerGUI::render_plot_panel() {
     // Payoff diagram
     if (ImPlot::BeginPlot("Payoff at Expiration", ImVec2(-1, -1))) {
         ImPlot::SetupAxes("Underlying Price ($)", "Payoff ($)");
-        ImPlot::SetupAxisLimits(ImAxis_X1, plot_x_data_.front(), plot_x_data_.back());
-        
-        // Calculate payoffs
-        std::vector<double> call_payoff, put_payoff;
-        call_payoff.reserve(plot_x_data_.size());
-        put_payoff.reserve(plot_x_data_.size());
+        ImPlot::SetupAxisLimits(ImAxis_X1, prices.front(), prices.back());
         
-        for (const double price : plot_x_data_) {
-            call_payoff.push_back(std::max(0.0, price - static_cast<double>(strike_price_)));
-            put_payoff.push_back(std::max(0.0, static_cast<double>(strike_price_) - price));
-        }
+        const ImPlotRect view = ImPlot::GetPlotLimits();
+        const int width = static_cast<int>(ImPlot::GetPlotSize().x);
         
         if (current_plot_type_ == PlotType::CallPrice || current_plot_type_ == PlotType::Both) {
+            lod_call_payoff_.update(prices, model_.call_payoff(), version, view.X.Min, view.X.Max, width);
             ImPlot::SetNextLineStyle(ImVec4(0.2f, 0.8f, 0.2f, 0.7f), 1.5f);
-            ImPlot::PlotLine("Call Payoff", plot_x_data_.data(), call_payoff.data(), 
-                           static_cast<int>(plot_x_data_.size()));
+            ImPlot::PlotLine("Call Payoff", lod_call_payoff_.x().data(), lod_call_payoff_.y().data(),
+                             lod_call_payoff_.size());
         }
         
         if (current_plot_type_ == PlotType::PutPrice || current_plot_type_ == PlotType::Both) {
+            lod_put_payoff_.update(prices, model_.put_payoff(), version, view.X.Min, view.X.Max, width);
             ImPlot::SetNextLineStyle(ImVec4(0.8f, 0.2f, 0.2f, 0.7f), 1.5f);
-            ImPlot::PlotLine("Put Payoff", plot_x_data_.data(), put_payoff.data(), 
-                           static_cast<int>(plot_x_data_.size()));
+            ImPlot::PlotLine("Put Payoff", lod_put_payoff_.x().data(), lod_put_payoff_.y().data(),
+                             lod_put_payoff_.size());
         }
         
         ImPlot::EndPlot();
     }
 }
 
+void OptionPricerGUI::render_surface_panel() {
+    using BlackScholes::SurfaceAxis;
+    using BlackScholes::OptionField;
+    
+    const BlackScholes::GreeksSurface& surface = model_.surface();
+    BlackScholes::SurfaceAxis& axis = model_.inputs().surface_axis;
+    
+    ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Greeks Surface");
+    ImGui::Separator();
+    
+    ImGui::Text("Axes:");
+    ImGui::SameLine();
+    if (ImGui::RadioButton("Spot × Volatility", axis == SurfaceAxis::Volatility) && axis != SurfaceAxis::Volatility) {
+        axis = SurfaceAxis::Volatility;
+        model_.invalidate_surface();
+    }
+    ImGui::SameLine();
+    if (ImGui::RadioButton("Spot × Time", axis == SurfaceAxis::Time) && axis != SurfaceAxis::Time) {
+        axis = SurfaceAxis::Time;
+        model_.invalidate_surface();
+    }
+    
+    // Every field is computed together, so switching fields needs no rebuild
+    ImGui::SetNextItemWidth(200.0f);
+    if (ImGui::BeginCombo("Field", BlackScholes::option_field_label(surface_field_))) {
+        for (std::size_t f = 0; f < BlackScholes::option_field_count; ++f) {
+            const auto field = static_cast<OptionField>(f);
+            if (ImGui::Selectable(BlackScholes::option_field_label(field), field == surface_field_)) {
+                surface_field_ = field;
+            }
+        }
+        ImGui::EndCombo();
+    }
+    
+    if (!model_.results_valid() || surface.empty()) {
+        ImGui::Text("No data to display. Please check parameters and calculate.");
+        return;
+    }
+    
+    const BlackScholes::SurfaceSpec& spec = surface.spec();
+    const std::span<const double> values = surface.plane(surface_field_);
+    const BlackScholes::SurfaceRange range = surface.range(surface_field_);
+    // A flat plane still needs a non-empty color range
+    const double scale_min = range.min;
+    const double scale_max = range.max > range.min ? range.max : range.min + 1.0;
+    
+    // Grid values sit at cell centers, so the cells overhang the grid by half a step
+    const double half_spot = 0.5 * (spec.spot_max - spec.spot_min) / static_cast<double>(spec.columns - 1);
+    const double half_axis = 0.5 * (spec.axis_max - spec.axis_min) / static_cast<double>(spec.rows - 1);
+    
+    ImPlot::PushColormap(ImPlotColormap_Viridis);
+    if (ImPlot::BeginPlot("##GreeksSurface", ImVec2(ImGui::GetContentRegionAvail().x - 90.0f, -1), ImPlotFlags_NoLegend)) {
+        ImPlot::SetupAxes("Underlying Price ($)",
+                          spec.axis == SurfaceAxis::Volatility ? "Volatility (σ)" : "Time to Expiration (years)",
+                          ImPlotAxisFlags_NoGridLines, ImPlotAxisFlags_NoGridLines);
+        ImPlot::SetupAxesLimits(spec.spot_min - half_spot, spec.spot_max + half_spot,
+                                spec.axis_min - half_axis, spec.axis_max + half_axis, ImPlotCond_Always);
+        ImPlot::PlotHeatmap(BlackScholes::option_field_label(surface_field_), values.data(),
+                            static_cast<int>(spec.rows), static_cast<int>(spec.columns),
+                            scale_min, scale_max, nullptr,
+                            ImPlotPoint(spec.spot_min - half_spot, spec.axis_min - half_axis),
+                            ImPlotPoint(spec.spot_max + half_spot, spec.axis_max + half_axis));
+        ImPlot::EndPlot();
+    }
+    ImGui::SameLine();
+    ImPlot::ColormapScale("##SurfaceScale", scale_min, scale_max, ImVec2(80.0f, -1));
+    ImPlot::PopColormap();
+}
+
 void OptionPricerGUI::render_greeks_panel() {
     ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Greeks Analysis");
     ImGui::Separator();
     
-    if (!results_valid_) {
+    if (!model_.results_valid()) {
         ImGui::Text("No valid results to display Greeks.");
         return;
     }
+    const BlackScholes::OptionPrices& prices = model_.prices();
     
     // Create table for Greeks
     if (ImGui::BeginTable("Greeks", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
@@ -320,101 +505,127 @@ void OptionPricerGUI::render_greeks_panel() {
         // Delta
         ImGui::TableNextRow();
         ImGui::TableNextColumn(); ImGui::Text("Delta");
-        ImGui::TableNextColumn(); ImGui::Text("%.4f", current_prices_.delta_call);
-        ImGui::TableNextColumn(); ImGui::Text("%.4f", current_prices_.delta_put);
+        ImGui::TableNextColumn(); ImGui::Text("%.4f", prices.delta_call);
+        ImGui::TableNextColumn(); ImGui::Text("%.4f", prices.delta_put);
         
         // Gamma
         ImGui::TableNextRow();
         ImGui::TableNextColumn(); ImGui::Text("Gamma");
-        ImGui::TableNextColumn(); ImGui::Text("%.6f", current_prices_.gamma);
-        ImGui::TableNextColumn(); ImGui::Text("%.6f", current_prices_.gamma);
+        ImGui::TableNextColumn(); ImGui::Text("%.6f", prices.gamma);
+        ImGui::TableNextColumn(); ImGui::Text("%.6f", prices.gamma);
         
         // Theta
         ImGui::TableNextRow();
         ImGui::TableNextColumn(); ImGui::Text("Theta");
-        ImGui::TableNextColumn(); ImGui::Text("%.4f", current_prices_.theta_call);
-        ImGui::TableNextColumn(); ImGui::Text("%.4f", current_prices_.theta_put);
+        ImGui::TableNextColumn(); ImGui::Text("%.4f", prices.theta_call);
+        ImGui::TableNextColumn(); ImGui::Text("%.4f", prices.theta_put);
         
         // Vega
         ImGui::TableNextRow();
         ImGui::TableNextColumn(); ImGui::Text("Vega");
-        ImGui::TableNextColumn(); ImGui::Text("%.4f", current_prices_.vega);
-        ImGui::TableNextColumn(); ImGui::Text("%.4f", current_prices_.vega);
+        ImGui::TableNextColumn(); ImGui::Text("%.4f", prices.vega);
+        ImGui::TableNextColumn(); ImGui::Text("%.4f", prices.vega);
         
         // Rho
         ImGui::TableNextRow();
         ImGui::TableNextColumn(); ImGui::Text("Rho");
-        ImGui::TableNextColumn(); ImGui::Text("%.4f", current_prices_.rho_call);
-        ImGui::TableNextColumn(); ImGui::Text("%.4f", current_prices_.rho_put);
+        ImGui::TableNextColumn(); ImGui::Text("%.4f", prices.rho_call);
+        ImGui::TableNextColumn(); ImGui::Text("%.4f", prices.rho_put);
         
         ImGui::EndTable();
     }
 }
 
-void OptionPricerGUI::update_calculations() {
-    try {
-        const auto params = get_current_parameters();
-        current_prices_ = BlackScholes::Model::calculate_prices(params);
-        results_valid_ = true;
-        error_message_.clear();
-        update_plot_data();
-    } catch (const std::exception& e) {
-        results_valid_ = false;
-        error_message_ = e.what();
-    }
-}
-
-void OptionPricerGUI::update_plot_data() {
-    if (!results_valid_) {
+void OptionPricerGUI::render_performance_overlay() {
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(ImVec2(viewport->WorkPos.x + viewport->WorkSize.x - 380.0f, viewport->WorkPos.y + 10.0f),
+                            ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(370.0f, 430.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.9f);
+    
+    if (!ImGui::Begin("Performance", &show_performance_overlay_, ImGuiWindowFlags_NoFocusOnAppearing)) {
+        ImGui::End();
         return;
     }
     
-    try {
-        const auto params = get_current_parameters();
-        const auto curve_data = BlackScholes::Model::generate_price_curve(
-            params, static_cast<double>(price_range_), num_plot_points_);
-        
-        plot_x_data_.clear();
-        plot_call_data_.clear();
-        plot_put_data_.clear();
-        
-        plot_x_data_.reserve(curve_data.size());
-        plot_call_data_.reserve(curve_data.size());
-        plot_put_data_.reserve(curve_data.size());
+    const FrameStats& stats = frame_stats_;
+    const ImGuiIO& io = ImGui::GetIO();
+    ImGui::Text("%.1f FPS (%.2f ms/frame)", io.Framerate, io.Framerate > 0.0f ? 1000.0f / io.Framerate : 0.0f);
+    
+    // Rolling frame times, oldest first
+    if (ImPlot::BeginPlot("Frame Times", ImVec2(-1, 160))) {
+        ImPlot::SetupAxes("Frame", "ms", 0, ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupAxisLimits(ImAxis_X1, 0, FrameStats::history_size, ImPlotCond_Always);
+        const int offset = FrameStats::history_size - stats.history_count;
+        ImPlot::SetNextLineStyle(ImVec4(0.26f, 0.59f, 0.98f, 1.0f), 1.5f);
+        ImPlot::PlotLine("Frame interval", stats.frame_ms.data() + offset, stats.history_count, 1.0, offset);
+        ImPlot::SetNextLineStyle(ImVec4(0.9f, 0.6f, 0.2f, 1.0f), 1.5f);
+        ImPlot::PlotLine("render()", stats.render_ms.data() + offset, stats.history_count, 1.0, offset);
+        ImPlot::EndPlot();
+    }
+    
+    // Last frame by stage
+    ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Last Frame");
+    ImGui::Separator();
+    if (ImGui::BeginTable("FrameBreakdown", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Stage");
+        ImGui::TableSetupColumn("ms", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+        ImGui::TableHeadersRow();
         
-        for (const auto& [price, call, put] : curve_data) {
-            plot_x_data_.push_back(price);
-            plot_call_data_.push_back(call);
-            plot_put_data_.push_back(put);
+        const double other_ms = std::max(0.0, stats.last_render_ms - stats.last_calculate_ms
+                                              - stats.last_plot_build_ms - stats.last_plot_render_ms);
+        const std::array<std::pair<const char*, double>, 5> stages{{
+            {"Calculate", stats.last_calculate_ms},
+            {"Plot build", stats.last_plot_build_ms},
+            {"Plot render", stats.last_plot_render_ms},
+            {"Other UI", other_ms},
+            {"render() total", stats.last_render_ms}
+        }};
+        for (const auto& [stage, ms] : stages) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("%s", stage);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", ms);
         }
-    } catch (const std::exception& e) {
-        // Handle plot data generation errors gracefully
-        plot_x_data_.clear();
-        plot_call_data_.clear();
-        plot_put_data_.clear();
+        ImGui::EndTable();
     }
+    
+    // Pricing throughput
+    ImGui::Spacing();
+    ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Pricing");
+    ImGui::Separator();
+    ImGui::Text("Last update: %.3f ms", model_.last_update_ms());
+    ImGui::Text("Curve throughput: %.2f M points/s", model_.points_per_second() * 1e-6);
+    
+    // Allocations
+    ImGui::Spacing();
+    ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Memory");
+    ImGui::Separator();
+    ImGui::Text("Allocations last frame: %zu", stats.last_allocations);
+    ImGui::SameLine();
+    show_help_marker("Heap allocations by the pricer's own buffers and arenas; ImGui's internal allocations are not counted");
+    ImGui::Text("Heap in use: %.1f KiB", static_cast<double>(heap_counter_.bytes_in_use()) / 1024.0);
+    ImGui::Text("Frame arena: %.1f / %.1f KiB", static_cast<double>(frame_arena_.used()) / 1024.0,
+                static_cast<double>(frame_arena_.capacity()) / 1024.0);
+    
+    ImGui::End();
 }
 
-BlackScholes::OptionParameters OptionPricerGUI::get_current_parameters() const {
-    return BlackScholes::OptionParameters(
-        static_cast<double>(underlying_price_),
-        static_cast<double>(strike_price_),
-        static_cast<double>(time_to_expiration_),
-        static_cast<double>(risk_free_rate_),
-        static_cast<double>(volatility_)
-    );
+void OptionPricerGUI::update_model() {
+    const UpdateTimings timings = model_.update();
+    frame_stats_.calculate_ms += timings.calculate_ms;
+    frame_stats_.plot_build_ms += timings.plot_build_ms;
 }
 
-std::string OptionPricerGUI::format_currency(double value) {
-    std::ostringstream oss;
-    oss << "$" << std::fixed << std::setprecision(2) << value;
-    return oss.str();
+std::pmr::string OptionPricerGUI::format_currency(double value, std::pmr::memory_resource* resource) {
+    char buffer[64];
+    const int length = std::snprintf(buffer, sizeof(buffer), "$%.2f", value);
+    return std::pmr::string(buffer, static_cast<std::size_t>(std::clamp(length, 0, 63)), resource);
 }
 
-std::string OptionPricerGUI::format_percentage(double value) {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2) << (value * 100.0) << "%";
-    return oss.str();
+std::pmr::string OptionPricerGUI::format_percentage(double value, std::pmr::memory_resource* resource) {
+    char buffer[64];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%.2f%%", value * 100.0);
+    return std::pmr::string(buffer, static_cast<std::size_t>(std::clamp(length, 0, 63)), resource);
 }
 
 void OptionPricerGUI::show_help_marker(const char* help_text) {
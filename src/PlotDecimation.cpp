@@ -0,0 +1,87 @@
+#include "PlotDecimation.hpp"
+#include <algorithm>
+
+namespace GUI {
+
+void decimate_min_max(std::span<const double> x, std::span<const double> y,
+                      std::size_t first, std::size_t last, std::size_t buckets,
+                      std::pmr::vector<double>& out_x, std::pmr::vector<double>& out_y) {
+    out_x.clear();
+    out_y.clear();
+    last = std::min({last, x.size(), y.size()});
+    if (first >= last) {
+        return;
+    }
+
+    const std::size_t count = last - first;
+    if (buckets == 0 || count <= 2 * buckets) {
+        out_x.assign(x.begin() + first, x.begin() + last);
+        out_y.assign(y.begin() + first, y.begin() + last);
+        return;
+    }
+
+    out_x.reserve(2 * buckets + 2);
+    out_y.reserve(2 * buckets + 2);
+    auto keep = [&](std::size_t i) {
+        out_x.push_back(x[i]);
+        out_y.push_back(y[i]);
+    };
+
+    keep(first);
+    for (std::size_t b = 0; b < buckets; ++b) {
+        const std::size_t begin = first + count * b / buckets;
+        const std::size_t end = first + count * (b + 1) / buckets;
+        std::size_t low = begin;
+        std::size_t high = begin;
+        double low_value = y[begin];
+        double high_value = y[begin];
+        for (std::size_t i = begin + 1; i < end; ++i) {
+            const double value = y[i];
+            low = value < low_value ? i : low;
+            low_value = std::min(value, low_value);
+            high = value > high_value ? i : high;
+            high_value = std::max(value, high_value);
+        }
+
+        // The end points are already kept
+        const std::size_t lo_index = std::min(low, high);
+        const std::size_t hi_index = std::max(low, high);
+        if (lo_index != first && lo_index != last - 1) {
+            keep(lo_index);
+        }
+        if (hi_index != lo_index && hi_index != first && hi_index != last - 1) {
+            keep(hi_index);
+        }
+    }
+    keep(last - 1);
+}
+
+// DecimatedSeries implementation
+DecimatedSeries::DecimatedSeries(std::pmr::memory_resource* resource)
+    : x_(resource)
+    , y_(resource) {}
+
+bool DecimatedSeries::update(std::span<const double> x, std::span<const double> y, std::uint64_t version,
+                             double view_min, double view_max, int pixel_width) {
+    if (valid_ && version == version_ && view_min == view_min_ && view_max == view_max_
+        && pixel_width == pixel_width_) {
+        return false;
+    }
+
+    // Visible points plus one neighbor each side, so segments cross the plot edges
+    const auto begin = std::lower_bound(x.begin(), x.end(), view_min);
+    const auto end = std::upper_bound(begin, x.end(), view_max);
+    const std::size_t first = static_cast<std::size_t>(begin - x.begin());
+    const std::size_t last = static_cast<std::size_t>(end - x.begin());
+    decimate_min_max(x, y, first > 0 ? first - 1 : 0, std::min(last + 1, x.size()),
+                     static_cast<std::size_t>(std::max(pixel_width, 1)), x_, y_);
+
+    valid_ = true;
+    version_ = version;
+    view_min_ = view_min;
+    view_max_ = view_max;
+    pixel_width_ = pixel_width;
+    return true;
+}
+
+} // namespace GUI
@@ -0,0 +1,172 @@
+#include "PricerModel.hpp"
+#include "Instrumentation.hpp"
+#include "TraceEvents.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace GUI {
+
+namespace Instrumentation = BlackScholes::Instrumentation;
+namespace Tracing = BlackScholes::Tracing;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+// PricerInputs implementation
+BlackScholes::OptionParameters PricerInputs::parameters() const {
+    return BlackScholes::OptionParameters(
+        static_cast<double>(underlying_price),
+        static_cast<double>(strike_price),
+        static_cast<double>(time_to_expiration),
+        static_cast<double>(risk_free_rate),
+        static_cast<double>(volatility)
+    );
+}
+
+// PricerModel implementation
+PricerModel::PricerModel(std::pmr::memory_resource* resource)
+    : curve_(BlackScholes::ProgressiveCurve::default_coarse_points, resource)
+    , call_payoff_(resource)
+    , put_payoff_(resource)
+    , surface_(0, resource) {}
+
+UpdateTimings PricerModel::update() {
+    UpdateTimings timings;
+    const auto update_start = Clock::now();
+    const bool repricing = prices_dirty_;
+
+    if (prices_dirty_) {
+        update_prices(timings);
+    }
+    if (curve_dirty_) {
+        update_curve(timings);
+    }
+    if (repricing) {
+        last_update_ms_ = elapsed_ms(update_start);
+    }
+
+    // Swap in the full-resolution curve once the background refinement is done
+    if (curve_.poll()) {
+        const double refine_ms = curve_.last_refine_ms();
+        points_per_second_ = refine_ms > 0.0 ? static_cast<double>(curve_.size()) / (refine_ms * 1e-3) : 0.0;
+    }
+
+    // Payoffs follow every curve change, coarse or refined
+    if (payoff_version_ != curve_.version()) {
+        update_payoffs(timings);
+    }
+    if (surface_dirty_ && surface_visible_) {
+        update_surface(timings);
+    }
+    return timings;
+}
+
+void PricerModel::update_prices(UpdateTimings& timings) {
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::GuiCalculate);
+    const Tracing::TraceSpan span("PricerModel::update_prices", "gui");
+    const auto start = Clock::now();
+    prices_dirty_ = false;
+
+    try {
+        const auto params = inputs_.parameters();
+        prices_ = BlackScholes::Model::calculate_prices(params);
+        const double parity_lhs = prices_.call_price - prices_.put_price;
+        const double parity_rhs = params.underlying_price
+            - params.strike_price * std::exp(-params.risk_free_rate * params.time_to_expiration);
+        parity_difference_ = std::abs(parity_lhs - parity_rhs);
+        results_valid_ = true;
+        error_message_.clear();
+        curve_dirty_ = true;
+        surface_dirty_ = true;
+    } catch (const std::exception& e) {
+        results_valid_ = false;
+        error_message_ = e.what();
+    }
+    timings.calculate_ms += elapsed_ms(start);
+}
+
+void PricerModel::update_curve(UpdateTimings& timings) {
+    curve_dirty_ = false;
+    if (!results_valid_) {
+        return;
+    }
+    Instrumentation::ScopedTimer timer(Instrumentation::Probe::GuiPlotUpdate);
+    const Tracing::TraceSpan span("PricerModel::update_curve", "gui", inputs_.plot_points);
+    const auto start = Clock::now();
+
+    try {
+        // Only the coarse pass runs here; large curves are refined in the background
+        curve_.request(inputs_.parameters(), static_cast<double>(inputs_.price_range),
+                       static_cast<std::size_t>(inputs_.plot_points));
+        timer.set_items(curve_.size());
+
+        const double build_ms = elapsed_ms(start);
+        timings.plot_build_ms += build_ms;
+        if (!curve_.refining()) {
+            points_per_second_ = build_ms > 0.0 ? static_cast<double>(curve_.size()) / (build_ms * 1e-3) : 0.0;
+        }
+    } catch (const std::exception&) {
+        // Nothing to plot; the results panel reports invalid inputs
+        curve_.clear();
+    }
+}
+
+void PricerModel::update_payoffs(UpdateTimings& timings) {
+    const Tracing::TraceSpan span("PricerModel::update_payoffs", "gui", static_cast<std::int64_t>(curve_.size()));
+    const auto start = Clock::now();
+
+    // Capacity is kept, so rebuilding a curve of the same size does not allocate
+    const std::span<const double> prices = curve_.underlying();
+    const double strike = static_cast<double>(inputs_.strike_price);
+    call_payoff_.resize(prices.size());
+    put_payoff_.resize(prices.size());
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+        call_payoff_[i] = std::max(0.0, prices[i] - strike);
+        put_payoff_[i] = std::max(0.0, strike - prices[i]);
+    }
+
+    payoff_version_ = curve_.version();
+    timings.plot_build_ms += elapsed_ms(start);
+}
+
+void PricerModel::update_surface(UpdateTimings& timings) {
+    surface_dirty_ = false;
+    if (!results_valid_) {
+        return;
+    }
+    const Tracing::TraceSpan span("PricerModel::update_surface", "gui");
+    const auto start = Clock::now();
+
+    try {
+        const auto params = inputs_.parameters();
+        BlackScholes::SurfaceSpec spec{
+            .axis = inputs_.surface_axis,
+            .spot_min = std::max(0.01, params.underlying_price - static_cast<double>(inputs_.price_range)),
+            .spot_max = params.underlying_price + static_cast<double>(inputs_.price_range),
+            .columns = static_cast<std::size_t>(inputs_.surface_points),
+            .rows = static_cast<std::size_t>(inputs_.surface_points)
+        };
+        if (inputs_.surface_axis == BlackScholes::SurfaceAxis::Volatility) {
+            spec.axis_min = 0.01;
+            spec.axis_max = std::max(0.5, 2.0 * params.volatility);
+        } else {
+            spec.axis_min = 1.0 / 365.25;
+            spec.axis_max = std::max(1.0, 2.0 * params.time_to_expiration);
+        }
+        surface_.compute(params, spec);
+    } catch (const std::exception&) {
+        // Keep the last surface; the results panel already reports bad inputs
+    }
+    timings.plot_build_ms += elapsed_ms(start);
+}
+
+} // namespace GUI
@@ -0,0 +1,185 @@
+#include "ProgressiveCurve.hpp"
+#include "Instrumentation.hpp"
+#include "PricingKernel.hpp"
+#include "TraceEvents.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+ProgressiveCurve::ProgressiveCurve(std::size_t coarse_points, std::pmr::memory_resource* resource)
+    : coarse_points_(std::max<std::size_t>(coarse_points, 2))
+    , underlying_(resource)
+    , call_(resource)
+    , put_(resource)
+    , back_underlying_(resource)
+    , back_call_(resource)
+    , back_put_(resource) {
+    worker_ = std::jthread([this](std::stop_token stop) { run(stop); });
+}
+
+ProgressiveCurve::~ProgressiveCurve() {
+    worker_.request_stop();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+ProgressiveCurve::Grid ProgressiveCurve::make_grid(const OptionParameters& params,
+                                                   double price_range,
+                                                   std::size_t num_points) {
+    if (num_points == 0) {
+        throw std::invalid_argument("Number of points must be positive");
+    }
+    if (!params.is_valid()) {
+        throw std::invalid_argument("Invalid parameters for Black-Scholes calculation");
+    }
+
+    // Same range and spacing as Model::generate_price_curve
+    const double start_price = std::max(0.01, params.underlying_price - price_range);
+    const double end_price = params.underlying_price + price_range;
+    if (!(end_price > 0.0) || !std::isfinite(end_price)) {
+        throw std::invalid_argument("Price range leaves no valid underlying prices");
+    }
+    return Grid{
+        .start_price = start_price,
+        .step = num_points > 1 ? (end_price - start_price) / static_cast<double>(num_points - 1) : 0.0,
+        .points = num_points,
+        .K = params.strike_price,
+        .T = params.time_to_expiration,
+        .r = params.risk_free_rate,
+        .q = params.dividend_yield,
+        .sigma = params.volatility
+    };
+}
+
+void ProgressiveCurve::price_points(const Grid& grid, std::size_t first, std::size_t last,
+                                    double* underlying, double* call, double* put) noexcept {
+    // Everything but ln(S/K) is shared by the whole curve
+    const double b = BlackScholesMerton::carry(grid.r, grid.q);
+    const double sigma_sqrt_T = grid.sigma * std::sqrt(grid.T);
+    const double inv_sigma_sqrt_T = 1.0 / sigma_sqrt_T;
+    const double drift_T = (b + 0.5 * grid.sigma * grid.sigma) * grid.T;
+    const double carry_factor = std::exp((b - grid.r) * grid.T);
+    const double K_discount = grid.K * std::exp(-grid.r * grid.T);
+    const double inv_K = 1.0 / grid.K;
+
+    for (std::size_t i = first; i < last; ++i) {
+        const double S = grid.start_price + static_cast<double>(i) * grid.step;
+        const double d1 = (std::log(S * inv_K) + drift_T) * inv_sigma_sqrt_T;
+        const Kernel::NormalTails tails_d1 = Kernel::normal_tails(d1);
+        const Kernel::NormalTails tails_d2 = Kernel::normal_tails(d1 - sigma_sqrt_T);
+        const double S_carry = S * carry_factor;
+
+        underlying[i] = S;
+        call[i] = S_carry * tails_d1.lower - K_discount * tails_d2.lower;
+        put[i] = K_discount * tails_d2.upper - S_carry * tails_d1.upper;
+    }
+}
+
+void ProgressiveCurve::request(const OptionParameters& params, double price_range, std::size_t num_points) {
+    const Grid grid = make_grid(params, price_range, num_points);
+    const bool refine_later = num_points > coarse_points_;
+    {
+        std::lock_guard lock(mutex_);
+        generation_.fetch_add(1, std::memory_order_relaxed);
+        ready_ = false;
+        pending_ = refine_later;
+        job_ = grid;
+    }
+    if (refine_later) {
+        wake_.notify_one();
+    }
+
+    // The coarse pass spans the same range while the worker runs in parallel
+    Grid coarse = grid;
+    if (refine_later) {
+        coarse.points = coarse_points_;
+        coarse.step = grid.step * static_cast<double>(num_points - 1) / static_cast<double>(coarse_points_ - 1);
+    }
+    underlying_.resize(coarse.points);
+    call_.resize(coarse.points);
+    put_.resize(coarse.points);
+    price_points(coarse, 0, coarse.points, underlying_.data(), call_.data(), put_.data());
+    target_points_ = num_points;
+    ++version_;
+}
+
+bool ProgressiveCurve::poll() {
+    if (!refining()) {
+        return false;
+    }
+    std::lock_guard lock(mutex_);
+    if (!ready_) {
+        return false;
+    }
+    ready_ = false;
+    underlying_.swap(back_underlying_);
+    call_.swap(back_call_);
+    put_.swap(back_put_);
+    last_refine_ms_ = back_ms_;
+    ++version_;
+    return true;
+}
+
+void ProgressiveCurve::clear() noexcept {
+    {
+        std::lock_guard lock(mutex_);
+        generation_.fetch_add(1, std::memory_order_relaxed);
+        ready_ = false;
+        pending_ = false;
+    }
+    underlying_.clear();
+    call_.clear();
+    put_.clear();
+    target_points_ = 0;
+    ++version_;
+}
+
+void ProgressiveCurve::run(std::stop_token stop) {
+    if (Tracing::enabled()) {
+        Tracing::set_thread_name("Curve refiner");
+    }
+    std::unique_lock lock(mutex_);
+    while (wake_.wait(lock, stop, [this] { return pending_; })) {
+        const Grid grid = job_;
+        const std::uint64_t generation = generation_.load(std::memory_order_relaxed);
+        pending_ = false;
+
+        lock.unlock();
+        const bool finished = refine(grid, generation, stop);
+        lock.lock();
+
+        // A request that arrived after the last chunk still wins
+        if (finished && generation == generation_.load(std::memory_order_relaxed)) {
+            ready_ = true;
+        }
+    }
+}
+
+bool ProgressiveCurve::refine(const Grid& grid, std::uint64_t generation, std::stop_token stop) {
+    Instrumentation::ScopedTimer timer(Instrumentation::Probe::CurveRefine);
+    const Tracing::TraceSpan span("ProgressiveCurve::refine", "pricing", static_cast<std::int64_t>(grid.points));
+    const auto start = std::chrono::steady_clock::now();
+
+    back_underlying_.resize(grid.points);
+    back_call_.resize(grid.points);
+    back_put_.resize(grid.points);
+
+    for (std::size_t first = 0; first < grid.points; first += refine_chunk) {
+        if (stop.stop_requested() || generation_.load(std::memory_order_relaxed) != generation) {
+            timer.set_items(first);
+            return false;
+        }
+        const std::size_t last = std::min(first + refine_chunk, grid.points);
+        price_points(grid, first, last, back_underlying_.data(), back_call_.data(), back_put_.data());
+    }
+
+    timer.set_items(grid.points);
+    back_ms_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+} // namespace BlackScholes
@@ -0,0 +1,390 @@
+#include "SabrModel.hpp"
+#include "Instrumentation.hpp"
+#include "PricingKernel.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+namespace {
+
+/**
+ * @brief Strike-independent terms of the expansion for one expiry
+ */
+struct SmileTerms {
+    double alpha;
+    double one_minus_beta;
+    double rho;
+    double nu;
+    double time_factor_a;  ///< Coefficient of α²/(FK)^(1-β) in the time correction
+    double time_factor_b;  ///< Coefficient of α/(FK)^((1-β)/2)
+    double time_factor_c;  ///< Constant term (2 - 3ρ²)ν²/24
+    double expiry;
+    bool obloj;
+};
+
+/**
+ * @brief Parameter-independent terms of one strike, reusable across calibration steps
+ */
+struct StrikeTerms {
+    double log_moneyness;  ///< ln(F/K)
+    double fk_half;        ///< (FK)^((1-β)/2)
+    double obloj_scale;    ///< (1-β)·ln(F/K)/(F^(1-β) - K^(1-β)), the Obloj q factor
+    double hagan_scale;    ///< 1/((FK)^((1-β)/2)·(1 + (1-β)²/24·ln² + (1-β)⁴/1920·ln⁴))
+};
+
+SmileTerms make_terms(const SabrParameters& p, double expiry, SabrExpansion expansion) noexcept {
+    const double omb = 1.0 - p.beta;
+    return SmileTerms{
+        .alpha = p.alpha,
+        .one_minus_beta = omb,
+        .rho = p.rho,
+        .nu = p.nu,
+        .time_factor_a = omb * omb * p.alpha * p.alpha / 24.0,
+        .time_factor_b = p.rho * p.beta * p.nu * p.alpha / 4.0,
+        .time_factor_c = (2.0 - 3.0 * p.rho * p.rho) * p.nu * p.nu / 24.0,
+        .expiry = expiry,
+        .obloj = expansion == SabrExpansion::Obloj
+    };
+}
+
+StrikeTerms make_strike_terms(double log_forward, double beta, double strike) noexcept {
+    const double omb = 1.0 - beta;
+    const double log_strike = std::log(strike);
+    const double lfk = log_forward - log_strike;
+    const double fk_half = std::exp(0.5 * omb * (log_forward + log_strike));
+
+    // F^a - K^a = 2(FK)^(a/2)·sinh(a·ln(F/K)/2) avoids cancellation near the money
+    const double s = 0.5 * omb * lfk;
+    const double s_over_sinh = std::abs(s) < 1e-8 ? 1.0 - s * s / 6.0 : s / std::sinh(s);
+
+    const double omb2_l2 = omb * omb * lfk * lfk;
+    return StrikeTerms{
+        .log_moneyness = lfk,
+        .fk_half = fk_half,
+        .obloj_scale = s_over_sinh / fk_half,
+        .hagan_scale = 1.0 / (fk_half * (1.0 + omb2_l2 / 24.0 + omb2_l2 * omb2_l2 / 1920.0))
+    };
+}
+
+/**
+ * @brief z/x(z), with its series used near z = 0 where x(z) vanishes
+ */
+inline double z_over_x(double z, double rho) noexcept {
+    const double x = std::log((std::sqrt(1.0 - 2.0 * rho * z + z * z) + z - rho) / (1.0 - rho));
+    return std::abs(z) < 1e-8 ? 1.0 - 0.5 * rho * z : z / x;
+}
+
+/**
+ * @brief Implied volatility at one strike from precomputed terms
+ *
+ * The only branch is on the expansion, which is invariant across a batch.
+ */
+inline double smile_volatility(const SmileTerms& t, const StrikeTerms& k) noexcept {
+    const double time_correction = 1.0 + (t.time_factor_a / (k.fk_half * k.fk_half)
+                                          + t.time_factor_b / k.fk_half
+                                          + t.time_factor_c) * t.expiry;
+
+    if (t.obloj) {
+        // I⁰ = ν·ln(F/K)/x(z) with z = ν(F^(1-β) - K^(1-β))/(α(1-β))
+        const double z = t.nu * k.log_moneyness / (t.alpha * k.obloj_scale);
+        return t.alpha * k.obloj_scale * z_over_x(z, t.rho) * time_correction;
+    }
+
+    const double z = t.nu / t.alpha * k.fk_half * k.log_moneyness;
+    return t.alpha * k.hagan_scale * z_over_x(z, t.rho) * time_correction;
+}
+
+void validate_inputs(const SabrParameters& params, double forward, double expiry) {
+    if (!params.is_valid()) {
+        throw std::invalid_argument("Invalid SABR parameters");
+    }
+    if (!(forward > 0.0) || !(expiry > 0.0) || !std::isfinite(forward) || !std::isfinite(expiry)) {
+        throw std::invalid_argument("SABR needs positive forward and expiry");
+    }
+}
+
+void validate_strikes(std::span<const double> strikes) {
+    for (const double K : strikes) {
+        if (!(K > 0.0) || !std::isfinite(K)) {
+            throw std::invalid_argument("SABR strikes must be positive");
+        }
+    }
+}
+
+void validate_slice(const SabrSlice& slice) {
+    if (!(slice.expiry > 0.0) || !(slice.forward > 0.0)) {
+        throw std::invalid_argument("SABR slice needs positive expiry and forward");
+    }
+    if (slice.strikes.size() != slice.volatilities.size() || slice.strikes.size() < 3) {
+        throw std::invalid_argument("SABR slice needs at least three strike/volatility pairs");
+    }
+    if (!slice.weights.empty() && slice.weights.size() != slice.strikes.size()) {
+        throw std::invalid_argument("SABR slice weights must match the strikes");
+    }
+    for (std::size_t i = 0; i < slice.strikes.size(); ++i) {
+        if (!(slice.strikes[i] > 0.0) || !(slice.volatilities[i] > 0.0)) {
+            throw std::invalid_argument("SABR slice strikes and volatilities must be positive");
+        }
+        if (i > 0 && !(slice.strikes[i] > slice.strikes[i - 1])) {
+            throw std::invalid_argument("SABR slice strikes must be strictly increasing");
+        }
+    }
+}
+
+/**
+ * @brief Market ATM volatility, linear in strike and flat beyond the quotes
+ */
+double atm_volatility(const SabrSlice& slice) noexcept {
+    const auto& K = slice.strikes;
+    const auto& v = slice.volatilities;
+    if (slice.forward <= K.front()) {
+        return v.front();
+    }
+    if (slice.forward >= K.back()) {
+        return v.back();
+    }
+    const std::size_t hi = static_cast<std::size_t>(
+        std::upper_bound(K.begin(), K.end(), slice.forward) - K.begin());
+    const double w = (slice.forward - K[hi - 1]) / (K[hi] - K[hi - 1]);
+    return v[hi - 1] + w * (v[hi] - v[hi - 1]);
+}
+
+void project_sabr(std::array<double, 2>& p) noexcept {
+    auto& [rho, nu] = p;
+    rho = std::clamp(rho, -0.999, 0.999);
+    nu = std::clamp(nu, 1e-4, 10.0);
+}
+
+} // namespace
+
+bool SabrParameters::is_valid() const noexcept {
+    return alpha > 0.0 && beta >= 0.0 && beta <= 1.0 && rho > -1.0 && rho < 1.0 && nu >= 0.0
+        && std::isfinite(alpha) && std::isfinite(nu);
+}
+
+namespace Sabr {
+
+double implied_volatility(const SabrParameters& params, double forward, double strike,
+                          double expiry, SabrExpansion expansion) noexcept {
+    return smile_volatility(make_terms(params, expiry, expansion),
+                            make_strike_terms(std::log(forward), params.beta, strike));
+}
+
+void implied_volatility_batch(const SabrParameters& params, double forward, double expiry,
+                              std::span<const double> strikes, std::span<double> volatilities,
+                              SabrExpansion expansion) {
+    validate_inputs(params, forward, expiry);
+    if (volatilities.size() != strikes.size()) {
+        throw std::invalid_argument("Mismatched SABR batch sizes");
+    }
+    validate_strikes(strikes);
+
+    const SmileTerms terms = make_terms(params, expiry, expansion);
+    const double log_forward = std::log(forward);
+    const std::size_t n = strikes.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        volatilities[i] = smile_volatility(terms, make_strike_terms(log_forward, params.beta, strikes[i]));
+    }
+}
+
+void price_batch(const SabrParameters& params, double forward, double expiry, double rate,
+                 std::span<const double> strikes, std::span<double> calls, std::span<double> puts,
+                 SabrExpansion expansion) {
+    validate_inputs(params, forward, expiry);
+    if (calls.size() != strikes.size() || puts.size() != strikes.size()) {
+        throw std::invalid_argument("Mismatched SABR batch sizes");
+    }
+    validate_strikes(strikes);
+
+    const SmileTerms terms = make_terms(params, expiry, expansion);
+    const double log_forward = std::log(forward);
+    const std::size_t n = strikes.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        const double volatility = smile_volatility(terms, make_strike_terms(log_forward, params.beta, strikes[i]));
+        const Kernel::OptionValues v = Kernel::value<Black76>(forward, strikes[i], expiry, rate, 0.0, volatility);
+        calls[i] = v.call_price;
+        puts[i] = v.put_price;
+    }
+}
+
+double alpha_from_atm(double atm_volatility, double forward, double expiry,
+                      double beta, double rho, double nu) noexcept {
+    // σ_ATM·F^(1-β) = c₁α + c₂α² + c₃α³ at K = F (identical for both expansions)
+    const double f_omb = std::pow(forward, 1.0 - beta);
+    const double target = atm_volatility * f_omb;
+    const double c3 = (1.0 - beta) * (1.0 - beta) * expiry / (24.0 * f_omb * f_omb);
+    const double c2 = rho * beta * nu * expiry / (4.0 * f_omb);
+    const double c1 = 1.0 + (2.0 - 3.0 * rho * rho) * nu * nu * expiry / 24.0;
+    const auto f = [&](double a) { return ((c3 * a + c2) * a + c1) * a - target; };
+    const auto df = [&](double a) { return (3.0 * c3 * a + 2.0 * c2) * a + c1; };
+
+    // f(0) < 0: bracket the first sign change, then safeguarded Newton
+    double lo = 0.0;
+    double hi = target / std::max(c1, 1e-3);
+    for (int i = 0; i < 60 && f(hi) < 0.0; ++i) {
+        lo = hi;
+        hi *= 2.0;
+    }
+    if (f(hi) < 0.0) {
+        return 0.0;
+    }
+
+    double a = hi;
+    for (int i = 0; i < 100; ++i) {
+        const double value = f(a);
+        if (value > 0.0) {
+            hi = a;
+        } else {
+            lo = a;
+        }
+        const double slope = df(a);
+        const double newton = slope > 0.0 ? a - value / slope : a;
+        if (std::abs(newton - a) <= 1e-14 * a) {
+            return newton;
+        }
+        a = (newton > lo && newton < hi) ? newton : 0.5 * (lo + hi);
+    }
+    return a;
+}
+
+} // namespace Sabr
+
+namespace {
+
+/**
+ * @brief Fit a single slice from a starting (ρ, ν)
+ * @param geometry Scratch for the slice's strike terms, one per strike
+ */
+SabrFitResult fit_slice(const SabrSlice& slice, double rho, double nu, double beta, SabrExpansion expansion,
+                        const CalibrationConfig& config, std::span<StrikeTerms> geometry) {
+    const double F = slice.forward;
+    const double T = slice.expiry;
+    const double atm = atm_volatility(slice);
+
+    // Strike geometry does not depend on (ρ, ν, α), so it is computed once per fit
+    const double log_forward = std::log(F);
+    for (std::size_t i = 0; i < geometry.size(); ++i) {
+        geometry[i] = make_strike_terms(log_forward, beta, slice.strikes[i]);
+    }
+
+    // Smile terms at (ρ, ν) and at the four central-difference bumps, with α
+    // solved from the ATM constraint; refreshed only when the LM point moves
+    std::array<double, 2> cached_point{std::nan(""), std::nan("")};
+    std::array<SmileTerms, 5> cached_terms{};
+    double h_rho = 0.0;
+    double h_nu = 0.0;
+    const auto terms_at = [&](double p_rho, double p_nu) {
+        const double alpha = std::max(Sabr::alpha_from_atm(atm, F, T, beta, p_rho, p_nu), 1e-12);
+        return make_terms(SabrParameters{.alpha = alpha, .beta = beta, .rho = p_rho, .nu = p_nu}, T, expansion);
+    };
+
+    // Two-parameter model in (ρ, ν); the Jacobian uses central differences so
+    // it includes the implicit dependence of α on both parameters
+    const auto model = [&](const std::array<double, 2>& p, std::size_t i, std::array<double, 2>& grad) {
+        if (p != cached_point) {
+            const auto [p_rho, p_nu] = p;
+            h_rho = 1e-6;
+            h_nu = 1e-6 * std::max(p_nu, 1e-2);
+            cached_terms = {terms_at(p_rho, p_nu),
+                            terms_at(p_rho + h_rho, p_nu), terms_at(p_rho - h_rho, p_nu),
+                            terms_at(p_rho, p_nu + h_nu), terms_at(p_rho, p_nu - h_nu)};
+            cached_point = p;
+        }
+        const StrikeTerms& k = geometry[i];
+        grad[0] = (smile_volatility(cached_terms[1], k) - smile_volatility(cached_terms[2], k)) / (2.0 * h_rho);
+        grad[1] = (smile_volatility(cached_terms[3], k) - smile_volatility(cached_terms[4], k)) / (2.0 * h_nu);
+        return smile_volatility(cached_terms[0], k);
+    };
+
+    const std::array<double, 2> initial{rho, nu};
+    const auto outcome = Detail::levenberg_marquardt<2>(initial, slice.volatilities, slice.weights,
+                                                        model, project_sabr, config);
+    const auto [fit_rho, fit_nu] = outcome.params;
+
+    double weight_sum = static_cast<double>(slice.strikes.size());
+    if (!slice.weights.empty()) {
+        weight_sum = 0.0;
+        for (const double w : slice.weights) {
+            weight_sum += w;
+        }
+    }
+
+    return SabrFitResult{
+        .params = SabrParameters{
+            .alpha = Sabr::alpha_from_atm(atm, F, T, beta, fit_rho, fit_nu),
+            .beta = beta,
+            .rho = fit_rho,
+            .nu = fit_nu
+        },
+        .rms_error = std::sqrt(outcome.cost / std::max(weight_sum, 1e-300)),
+        .iterations = outcome.iterations,
+        .converged = outcome.converged
+    };
+}
+
+} // namespace
+
+SabrCalibrator::SabrCalibrator(double beta, CalibrationConfig config, SabrExpansion expansion)
+    : beta_(beta)
+    , config_(config)
+    , expansion_(expansion)
+{
+    if (!(beta_ >= 0.0 && beta_ <= 1.0)) {
+        throw std::invalid_argument("SABR beta must lie in [0, 1]");
+    }
+}
+
+const std::vector<SabrFitResult>& SabrCalibrator::calibrate(std::span<const SabrSlice> slices,
+                                                            std::pmr::memory_resource* resource) {
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::Calibration, slices.size());
+    if (slices.empty()) {
+        throw std::invalid_argument("No slices to calibrate");
+    }
+    for (std::size_t i = 0; i < slices.size(); ++i) {
+        validate_slice(slices[i]);
+        if (i > 0 && !(slices[i].expiry > slices[i - 1].expiry)) {
+            throw std::invalid_argument("SABR slices must be sorted by increasing expiry");
+        }
+    }
+
+    // Warm start only when the previous calibration covered the same expiries
+    bool warm = results_.size() == slices.size();
+    for (std::size_t i = 0; warm && i < slices.size(); ++i) {
+        warm = expiries_[i] == slices[i].expiry;
+    }
+
+    // All scratch is allocated here, so workers only write their own slices' ranges
+    std::pmr::vector<SabrFitResult> fitted(slices.size(), resource);
+    std::pmr::vector<std::size_t> offsets(slices.size() + 1, 0, resource);
+    for (std::size_t i = 0; i < slices.size(); ++i) {
+        offsets[i + 1] = offsets[i] + slices[i].strikes.size();
+    }
+    std::pmr::vector<StrikeTerms> geometry(offsets.back(), resource);
+
+    // Slices are handed out one at a time; the pool's threads persist across calls
+    if (!workers_) {
+        workers_ = std::make_unique<WorkerPool>(config_.num_threads, "SABR worker");
+    }
+    std::atomic<std::size_t> next{0};
+    workers_->run([&](unsigned) {
+        for (std::size_t i = next++; i < slices.size(); i = next++) {
+            const double rho = warm ? results_[i].params.rho : 0.0;
+            const double nu = warm ? results_[i].params.nu : 0.5;
+            fitted[i] = fit_slice(slices[i], rho, nu, beta_, expansion_, config_,
+                                  std::span(geometry).subspan(offsets[i], offsets[i + 1] - offsets[i]));
+        }
+    });
+
+    results_.assign(fitted.begin(), fitted.end());
+    expiries_.clear();
+    for (const SabrSlice& slice : slices) {
+        expiries_.push_back(slice.expiry);
+    }
+    return results_;
+}
+
+} // namespace BlackScholes
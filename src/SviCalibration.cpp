@@ -0,0 +1,283 @@
+#include "SviCalibration.hpp"
+#include "Instrumentation.hpp"
+#include "LevenbergMarquardt.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+namespace {
+
+double log_moneyness(double strike, double forward) noexcept {
+    return std::log(strike / forward);
+}
+
+void validate_slice(const SviSlice& slice) {
+    if (!(slice.expiry > 0.0) || !(slice.forward > 0.0)) {
+        throw std::invalid_argument("SVI slice needs positive expiry and forward");
+    }
+    if (slice.strikes.size() != slice.volatilities.size() || slice.strikes.size() < 5) {
+        throw std::invalid_argument("SVI slice needs at least five strike/volatility pairs");
+    }
+    if (!slice.weights.empty() && slice.weights.size() != slice.strikes.size()) {
+        throw std::invalid_argument("SVI slice weights must match the strikes");
+    }
+    for (std::size_t i = 0; i < slice.strikes.size(); ++i) {
+        if (!(slice.strikes[i] > 0.0) || !(slice.volatilities[i] > 0.0)) {
+            throw std::invalid_argument("SVI slice strikes and volatilities must be positive");
+        }
+    }
+}
+
+void validate_slices(std::span<const SviSlice> slices) {
+    if (slices.empty()) {
+        throw std::invalid_argument("No slices to calibrate");
+    }
+    for (std::size_t i = 0; i < slices.size(); ++i) {
+        validate_slice(slices[i]);
+        if (i > 0 && !(slices[i].expiry > slices[i - 1].expiry)) {
+            throw std::invalid_argument("SVI slices must be sorted by increasing expiry");
+        }
+    }
+}
+
+/**
+ * @brief Heuristic starting point when there is no previous calibration
+ */
+SviParameters cold_start(const SviSlice& slice) {
+    std::size_t atm = 0;
+    for (std::size_t i = 1; i < slice.strikes.size(); ++i) {
+        if (std::abs(log_moneyness(slice.strikes[i], slice.forward))
+            < std::abs(log_moneyness(slice.strikes[atm], slice.forward))) {
+            atm = i;
+        }
+    }
+    const double w_atm = slice.volatilities[atm] * slice.volatilities[atm] * slice.expiry;
+    constexpr double b = 0.1;
+    constexpr double sigma = 0.1;
+    return SviParameters{.a = std::max(w_atm - b * sigma, 1e-6), .b = b, .rho = -0.3, .m = 0.0, .sigma = sigma};
+}
+
+void project_svi(std::array<double, 5>& p) noexcept {
+    auto& [a, b, rho, m, sigma] = p;
+    b = std::max(b, 0.0);
+    rho = std::clamp(rho, -0.999, 0.999);
+    sigma = std::max(sigma, 1e-4);
+    // Minimum of the slice a + bσ√(1-ρ²) must stay non-negative
+    a = std::max(a, -b * sigma * std::sqrt(1.0 - rho * rho));
+    (void)m;
+}
+
+void project_ssvi(std::array<double, 3>& p) noexcept {
+    auto& [rho, eta, gamma] = p;
+    rho = std::clamp(rho, -0.999, 0.999);
+    gamma = std::clamp(gamma, 0.01, 0.5);
+    eta = std::clamp(eta, 1e-4, 2.0 / (1.0 + std::abs(rho)));
+}
+
+} // namespace
+
+double SviParameters::total_variance(double k) const noexcept {
+    const double d = k - m;
+    return a + b * (rho * d + std::sqrt(d * d + sigma * sigma));
+}
+
+double SsviParameters::curvature(double theta_t) const noexcept {
+    return eta / (std::pow(theta_t, gamma) * std::pow(1.0 + theta_t, 1.0 - gamma));
+}
+
+double SsviParameters::total_variance(double k, double theta_t) const noexcept {
+    const double phi = curvature(theta_t);
+    const double z = phi * k + rho;
+    return 0.5 * theta_t * (1.0 + rho * phi * k + std::sqrt(z * z + 1.0 - rho * rho));
+}
+
+const std::vector<SviFitResult>& SviCalibrator::calibrate(std::span<const SviSlice> slices,
+                                                          std::pmr::memory_resource* resource) {
+    const Instrumentation::ScopedTimer timer(Instrumentation::Probe::Calibration, slices.size());
+    validate_slices(slices);
+
+    // Warm start only when the previous calibration covered the same expiries
+    bool warm = results_.size() == slices.size();
+    for (std::size_t i = 0; warm && i < slices.size(); ++i) {
+        warm = expiries_[i] == slices[i].expiry;
+    }
+
+    // All scratch is allocated here, so workers only write their own slices' ranges
+    std::pmr::vector<SviFitResult> fitted(slices.size(), resource);
+    std::pmr::vector<std::size_t> offsets(slices.size() + 1, 0, resource);
+    for (std::size_t i = 0; i < slices.size(); ++i) {
+        offsets[i + 1] = offsets[i] + slices[i].strikes.size();
+    }
+    std::pmr::vector<double> k_points(offsets.back(), resource);
+    std::pmr::vector<double> targets(offsets.back(), resource);
+
+    // Slices are handed out one at a time; the pool's threads persist across calls
+    if (!workers_) {
+        workers_ = std::make_unique<WorkerPool>(config_.num_threads, "SVI worker");
+    }
+    std::atomic<std::size_t> next{0};
+    workers_->run([&](unsigned) {
+        for (std::size_t i = next++; i < slices.size(); i = next++) {
+            const SviParameters start = warm ? results_[i].params : cold_start(slices[i]);
+            const std::size_t n = offsets[i + 1] - offsets[i];
+            fitted[i] = fit_slice(slices[i], start, std::span(k_points).subspan(offsets[i], n),
+                                  std::span(targets).subspan(offsets[i], n));
+        }
+    });
+
+    results_.assign(fitted.begin(), fitted.end());
+    expiries_.clear();
+    forwards_.clear();
+    for (const SviSlice& slice : slices) {
+        expiries_.push_back(slice.expiry);
+        forwards_.push_back(slice.forward);
+    }
+    return results_;
+}
+
+const SsviParameters& SviCalibrator::calibrate_ssvi(std::span<const SviSlice> slices,
+                                                    std::pmr::memory_resource* resource) {
+    calibrate(slices, resource);
+
+    // ATM total variance per slice, forced non-decreasing to exclude calendar arbitrage
+    std::pmr::vector<double> theta(slices.size(), resource);
+    double running = 0.0;
+    for (std::size_t i = 0; i < slices.size(); ++i) {
+        running = std::max(running, std::max(results_[i].params.total_variance(0.0), 1e-8));
+        theta[i] = running;
+    }
+
+    std::size_t points = 0;
+    for (const SviSlice& slice : slices) {
+        points += slice.strikes.size();
+    }
+    std::pmr::vector<double> k_points(resource);
+    std::pmr::vector<double> theta_points(resource);
+    std::pmr::vector<double> targets(resource);
+    std::pmr::vector<double> weights(resource);
+    k_points.reserve(points);
+    theta_points.reserve(points);
+    targets.reserve(points);
+    weights.reserve(points);
+    for (std::size_t i = 0; i < slices.size(); ++i) {
+        const SviSlice& slice = slices[i];
+        for (std::size_t j = 0; j < slice.strikes.size(); ++j) {
+            k_points.push_back(log_moneyness(slice.strikes[j], slice.forward));
+            theta_points.push_back(theta[i]);
+            targets.push_back(slice.volatilities[j] * slice.volatilities[j] * slice.expiry);
+            weights.push_back(slice.weights.empty() ? 1.0 : slice.weights[j]);
+        }
+    }
+
+    const std::array<double, 3> start = has_ssvi_
+        ? std::array<double, 3>{ssvi_.rho, ssvi_.eta, ssvi_.gamma}
+        : std::array<double, 3>{-0.3, 1.0, 0.4};
+
+    const auto model = [&](const std::array<double, 3>& p, std::size_t i, std::array<double, 3>& grad) {
+        const auto [rho, eta, gamma] = p;
+        const double th = theta_points[i];
+        const double k = k_points[i];
+        const double phi = eta / (std::pow(th, gamma) * std::pow(1.0 + th, 1.0 - gamma));
+        const double z = phi * k + rho;
+        const double R = std::sqrt(z * z + 1.0 - rho * rho);
+        const double dw_dphi = 0.5 * th * (rho * k + z * k / R);
+
+        grad[0] = 0.5 * th * (phi * k + phi * k / R);
+        grad[1] = dw_dphi * phi / eta;
+        grad[2] = dw_dphi * phi * std::log1p(1.0 / th);
+        return 0.5 * th * (1.0 + rho * phi * k + R);
+    };
+
+    const auto outcome = Detail::levenberg_marquardt<3>(start, targets, weights, model, project_ssvi, config_);
+
+    // Assigned field by field so the retained vectors keep their capacity
+    ssvi_.rho = outcome.params[0];
+    ssvi_.eta = outcome.params[1];
+    ssvi_.gamma = outcome.params[2];
+    ssvi_.expiries = expiries_;
+    ssvi_.forwards = forwards_;
+    ssvi_.theta.assign(theta.begin(), theta.end());
+    has_ssvi_ = true;
+    return ssvi_;
+}
+
+VolSurface SviCalibrator::svi_surface(std::vector<double> strikes, VolInterpolation method,
+                                      std::pmr::memory_resource* resource) const {
+    if (results_.empty()) {
+        throw std::logic_error("SVI surface requested before calibration");
+    }
+
+    std::pmr::vector<double> vols(resource);
+    vols.reserve(expiries_.size() * strikes.size());
+    for (std::size_t i = 0; i < expiries_.size(); ++i) {
+        for (const double K : strikes) {
+            const double w = results_[i].params.total_variance(log_moneyness(K, forwards_[i]));
+            vols.push_back(std::sqrt(std::max(w, 1e-12) / expiries_[i]));
+        }
+    }
+    return VolSurface(std::move(strikes), expiries_, vols, method);
+}
+
+VolSurface SviCalibrator::ssvi_surface(std::vector<double> strikes, VolInterpolation method,
+                                       std::pmr::memory_resource* resource) const {
+    if (!has_ssvi_) {
+        throw std::logic_error("SSVI surface requested before calibration");
+    }
+
+    std::pmr::vector<double> vols(resource);
+    vols.reserve(ssvi_.expiries.size() * strikes.size());
+    for (std::size_t i = 0; i < ssvi_.expiries.size(); ++i) {
+        for (const double K : strikes) {
+            const double w = ssvi_.total_variance(log_moneyness(K, ssvi_.forwards[i]), ssvi_.theta[i]);
+            vols.push_back(std::sqrt(std::max(w, 1e-12) / ssvi_.expiries[i]));
+        }
+    }
+    return VolSurface(std::move(strikes), ssvi_.expiries, vols, method);
+}
+
+SviFitResult SviCalibrator::fit_slice(const SviSlice& slice, const SviParameters& start,
+                                      std::span<double> k, std::span<double> targets) const {
+    const std::size_t n = slice.strikes.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        k[i] = log_moneyness(slice.strikes[i], slice.forward);
+        targets[i] = slice.volatilities[i] * slice.volatilities[i] * slice.expiry;
+    }
+
+    const auto model = [&](const std::array<double, 5>& p, std::size_t i, std::array<double, 5>& grad) {
+        const auto [a, b, rho, m, sigma] = p;
+        const double d = k[i] - m;
+        const double s = std::sqrt(d * d + sigma * sigma);
+
+        grad[0] = 1.0;
+        grad[1] = rho * d + s;
+        grad[2] = b * d;
+        grad[3] = -b * (rho + d / s);
+        grad[4] = b * sigma / s;
+        return a + b * (rho * d + s);
+    };
+
+    const std::array<double, 5> initial{start.a, start.b, start.rho, start.m, start.sigma};
+    const auto outcome = Detail::levenberg_marquardt<5>(initial, targets, slice.weights, model, project_svi, config_);
+    const auto [a, b, rho, m, sigma] = outcome.params;
+
+    double weight_sum = static_cast<double>(n);
+    if (!slice.weights.empty()) {
+        weight_sum = 0.0;
+        for (const double w : slice.weights) {
+            weight_sum += w;
+        }
+    }
+
+    return SviFitResult{
+        .params = SviParameters{.a = a, .b = b, .rho = rho, .m = m, .sigma = sigma},
+        .rms_error = std::sqrt(outcome.cost / std::max(weight_sum, 1e-300)),
+        .iterations = outcome.iterations,
+        .converged = outcome.converged
+    };
+}
+
+} // namespace BlackScholes
@@ -0,0 +1,234 @@
+#include "TraceEvents.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace BlackScholes::Tracing {
+
+namespace {
+
+struct Span {
+    const char* name;
+    const char* category;
+    std::int64_t start_ns;
+    std::int64_t duration_ns;
+    std::int64_t items;
+};
+
+/**
+ * @brief Fixed-capacity block of spans; a buffer is a singly linked list of them
+ */
+struct Chunk {
+    explicit Chunk(std::size_t capacity) : spans(std::make_unique<Span[]>(capacity)), capacity(capacity) {}
+
+    std::unique_ptr<Span[]> spans;
+    std::size_t capacity;
+    std::atomic<std::size_t> published{0};  ///< Spans visible to the flusher
+    std::atomic<Chunk*> next{nullptr};
+};
+
+constexpr std::size_t first_chunk_spans = 256;
+constexpr std::size_t max_chunk_spans = 16384;
+constexpr std::size_t max_spans_per_thread = std::size_t{1} << 22;
+
+/**
+ * @brief One thread's span buffer
+ *
+ * Only the owning thread appends. Each span is written before the chunk's
+ * published count is advanced with release order, so the flusher, reading
+ * with acquire, sees only complete spans. Buffers are never freed: when a
+ * thread exits its buffer goes to a free list and the next new thread
+ * appends to it, so spans from joined threads survive until the final
+ * flush, a late span can never touch freed memory during static
+ * destruction, and short-lived workers do not grow the number of buffers.
+ */
+struct ThreadBuffer {
+    Chunk head{first_chunk_spans};
+    Chunk* tail = &head;
+    std::size_t total = 0;
+    std::uint32_t thread_id = 0;
+    std::atomic<const char*> thread_name{nullptr};
+    ThreadBuffer* next_buffer = nullptr;
+    ThreadBuffer* next_free = nullptr;
+
+    void append(const Span& span) {
+        std::size_t index = tail->published.load(std::memory_order_relaxed);
+        if (index == tail->capacity) {
+            auto* grown = new Chunk(std::min(tail->capacity * 2, max_chunk_spans));
+            tail->next.store(grown, std::memory_order_release);
+            tail = grown;
+            index = 0;
+        }
+        tail->spans[index] = span;
+        tail->published.store(index + 1, std::memory_order_release);
+        ++total;
+    }
+};
+
+std::atomic<ThreadBuffer*> buffers{nullptr};  ///< Lock-free stack of every thread's buffer
+std::atomic<std::uint32_t> next_thread_id{1};
+std::atomic<std::uint64_t> dropped{0};
+
+const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+std::mutex free_mutex;
+ThreadBuffer* free_buffers = nullptr;  ///< Buffers of exited threads, guarded by free_mutex
+
+ThreadBuffer* acquire_buffer() {
+    {
+        std::lock_guard lock(free_mutex);
+        if (ThreadBuffer* reused = free_buffers) {
+            free_buffers = reused->next_free;
+            return reused;
+        }
+    }
+    auto* created = new ThreadBuffer;
+    created->thread_id = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+    created->next_buffer = buffers.load(std::memory_order_relaxed);
+    while (!buffers.compare_exchange_weak(created->next_buffer, created,
+                                          std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    return created;
+}
+
+// Trivially destructible, so they stay readable while other thread_locals are destroyed
+thread_local ThreadBuffer* local = nullptr;
+thread_local bool thread_exited = false;
+
+/**
+ * @brief Returns the thread's buffer to the free list when the thread exits
+ */
+struct BufferLease {
+    ~BufferLease() {
+        thread_exited = true;
+        if (local == nullptr) {
+            return;
+        }
+        std::lock_guard lock(free_mutex);
+        local->next_free = free_buffers;
+        free_buffers = local;
+        local = nullptr;
+    }
+};
+
+/**
+ * @brief The calling thread's buffer, or nullptr once the thread is exiting
+ */
+ThreadBuffer* local_buffer() {
+    if (local == nullptr && !thread_exited) {
+        thread_local BufferLease lease;
+        local = acquire_buffer();
+    }
+    return local;
+}
+
+void write_json_string(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out << '\\';
+        }
+        out << *c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+void set_enabled(bool enabled) noexcept {
+    Detail::enabled_flag.store(enabled, std::memory_order_relaxed);
+}
+
+void set_thread_name(const char* name) noexcept {
+    if (ThreadBuffer* buffer = local_buffer()) {
+        buffer->thread_name.store(name, std::memory_order_relaxed);
+    }
+}
+
+std::int64_t now_ns() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void record_span(const char* name, const char* category,
+                 std::int64_t start_ns, std::int64_t end_ns, std::int64_t items) noexcept {
+    ThreadBuffer* buffer = local_buffer();
+    if (buffer == nullptr || buffer->total >= max_spans_per_thread) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    try {
+        buffer->append(Span{name, category, start_ns, end_ns - start_ns, items});
+    } catch (const std::bad_alloc&) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t dropped_spans() noexcept {
+    return dropped.load(std::memory_order_relaxed);
+}
+
+void write_chrome_trace(const std::string& path) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open trace file: " + path);
+    }
+
+    // Timestamps and durations are microseconds; keep nanosecond resolution
+    out << std::fixed;
+    out.precision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"ph\":\"M\",\"pid\":1,\"tid\":0,\"name\":\"process_name\",\"args\":{\"name\":\"Black-Scholes Option Pricer\"}}";
+
+    for (ThreadBuffer* buffer = buffers.load(std::memory_order_acquire); buffer != nullptr;
+         buffer = buffer->next_buffer) {
+        if (const char* name = buffer->thread_name.load(std::memory_order_relaxed)) {
+            out << ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->thread_id
+                << ",\"name\":\"thread_name\",\"args\":{\"name\":";
+            write_json_string(out, name);
+            out << "}}";
+        }
+
+        for (const Chunk* chunk = &buffer->head; chunk != nullptr;
+             chunk = chunk->next.load(std::memory_order_acquire)) {
+            const std::size_t count = chunk->published.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < count; ++i) {
+                const Span& span = chunk->spans[i];
+                out << ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id << ",\"name\":";
+                write_json_string(out, span.name);
+                out << ",\"cat\":";
+                write_json_string(out, span.category);
+                out << ",\"ts\":" << static_cast<double>(span.start_ns) * 1e-3
+                    << ",\"dur\":" << static_cast<double>(span.duration_ns) * 1e-3;
+                if (span.items >= 0) {
+                    out << ",\"args\":{\"items\":" << span.items << '}';
+                }
+                out << '}';
+            }
+        }
+    }
+
+    out << "\n]}\n";
+    if (!out.flush()) {
+        throw std::runtime_error("Cannot write trace file: " + path);
+    }
+}
+
+// TraceSession implementation
+TraceSession::TraceSession(std::string path) : path_(std::move(path)) {
+    set_enabled(true);
+}
+
+TraceSession::~TraceSession() {
+    set_enabled(false);
+    try {
+        flush();
+    } catch (const std::exception& e) {
+        std::cerr << "Trace export failed: " << e.what() << std::endl;
+    }
+}
+
+} // namespace BlackScholes::Tracing
@@ -0,0 +1,287 @@
+#include "VaREngine.hpp"
+#include "Instrumentation.hpp"
+#include "TraceEvents.hpp"
+#include "WorkerPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+namespace BlackScholes {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+bool is_scenario_line(const std::string& line) noexcept {
+    const auto first = line.find_first_not_of(" \t\r");
+    return first != std::string::npos && line[first] != '#';
+}
+
+/**
+ * @brief Number of largest losses averaged into ES out of n scenarios
+ */
+std::size_t tail_count(std::size_t n, double confidence) noexcept {
+    return std::max<std::size_t>(1, static_cast<std::size_t>(static_cast<double>(n) * (1.0 - confidence)));
+}
+
+} // namespace
+
+// ScenarioReader implementation
+std::size_t ScenarioReader::read_batch(std::pmr::vector<Scenario>& batch, std::size_t max_count) {
+    Tracing::TraceSpan span("ScenarioReader::read_batch", "io");
+    std::size_t count = 0;
+    if (batch.size() < max_count) {
+        batch.resize(max_count);
+    }
+
+    while (count < max_count && std::getline(input_, line_)) {
+        ++line_number_;
+        const auto first = line_.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line_[first] == '#') {
+            continue;
+        }
+
+        Scenario& scenario = batch[count];
+        scenario.spot_returns.clear();
+
+        const char* cursor = line_.c_str() + first;
+        std::size_t field = 0;
+        while (true) {
+            char* end = nullptr;
+            const double value = std::strtod(cursor, &end);
+            if (end == cursor || !std::isfinite(value)) {
+                throw std::runtime_error("Malformed scenario on line " + std::to_string(line_number_));
+            }
+
+            if (field == 0) {
+                scenario.rate_shift = value;
+            } else if (field == 1) {
+                scenario.volatility_shift = value;
+            } else {
+                scenario.spot_returns.push_back(value);
+            }
+            ++field;
+
+            while (*end == ' ' || *end == '\t' || *end == '\r') {
+                ++end;
+            }
+            if (*end == '\0') {
+                break;
+            }
+            if (*end != ',') {
+                throw std::runtime_error("Malformed scenario on line " + std::to_string(line_number_));
+            }
+            cursor = end + 1;
+        }
+
+        if (field < 3) {
+            throw std::runtime_error("Scenario needs at least one spot return on line "
+                                     + std::to_string(line_number_));
+        }
+        ++count;
+    }
+
+    span.set_items(static_cast<std::int64_t>(count));
+    return count;
+}
+
+std::optional<std::size_t> ScenarioReader::count_remaining(std::istream& input) {
+    const Tracing::TraceSpan span("ScenarioReader::count_remaining", "io");
+    const std::istream::pos_type start = input.tellg();
+    if (start == std::istream::pos_type(-1)) {
+        return std::nullopt;
+    }
+
+    std::size_t count = 0;
+    for (std::string line; std::getline(input, line);) {
+        if (is_scenario_line(line)) {
+            ++count;
+        }
+    }
+
+    input.clear();
+    if (!input.seekg(start)) {
+        throw std::runtime_error("Cannot rewind scenario input");
+    }
+    return count;
+}
+
+// VaREngine implementation
+VaREngine::VaREngine(std::vector<Position> book, VaRConfig config)
+    : book_(std::move(book))
+    , config_(config)
+{
+    if (book_.empty()) {
+        throw std::invalid_argument("VaR book must contain at least one position");
+    }
+    if (!(config_.confidence > 0.0 && config_.confidence < 1.0)) {
+        throw std::invalid_argument("VaR confidence must be in (0, 1)");
+    }
+    if (config_.batch_size == 0 || !(config_.horizon_days >= 0.0)) {
+        throw std::invalid_argument("Invalid VaR configuration");
+    }
+    if (config_.num_threads == 0) {
+        config_.num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (const Position& position : book_) {
+        if (!position.params.is_valid()) {
+            throw std::invalid_argument("Invalid parameters in VaR book");
+        }
+        const OptionParameters& p = position.params;
+        base_value_ += position_value(position, p.underlying_price, p.time_to_expiration,
+                                      p.risk_free_rate, p.volatility);
+    }
+}
+
+VaRResult VaREngine::run(std::istream& scenarios, std::pmr::memory_resource* resource) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Probe::VaRRun, 0);
+    const Tracing::TraceSpan run_span("VaREngine::run", "batch");
+    VaRTimings timings;
+
+    // Knowing n up front bounds the retained losses to the tail
+    auto stage_start = Clock::now();
+    const std::optional<std::size_t> expected = ScenarioReader::count_remaining(scenarios);
+    timings.read_ms += elapsed_ms(stage_start);
+    const std::size_t keep = expected ? tail_count(*expected, config_.confidence)
+                                      : std::numeric_limits<std::size_t>::max();
+
+    ScenarioReader reader(scenarios);
+    std::pmr::vector<Scenario> batch(resource);
+    std::pmr::vector<double> batch_pnl(config_.batch_size, resource);
+    std::pmr::vector<double> losses(resource);  ///< Max-heap of the most negative PnL seen
+    if (expected) {
+        losses.reserve(keep);
+    }
+    std::size_t n = 0;
+
+    WorkerPool workers(config_.num_threads, "VaR worker");
+    while (true) {
+        stage_start = Clock::now();
+        const std::size_t count = reader.read_batch(batch, config_.batch_size);
+        timings.read_ms += elapsed_ms(stage_start);
+        if (count == 0) {
+            break;
+        }
+
+        stage_start = Clock::now();
+        {
+            const Tracing::TraceSpan reprice_span("reprice_batch", "batch", static_cast<std::int64_t>(count));
+
+            // Split the batch into contiguous chunks, one per worker
+            const std::size_t chunk = (count + workers.size() - 1) / workers.size();
+            workers.run([&](unsigned worker) {
+                const std::size_t begin = std::min(count, worker * chunk);
+                const std::size_t end = std::min(count, begin + chunk);
+                if (begin == end) {
+                    return;
+                }
+                const Tracing::TraceSpan chunk_span("reprice_chunk", "batch", static_cast<std::int64_t>(end - begin));
+                for (std::size_t i = begin; i < end; ++i) {
+                    batch_pnl[i] = scenario_value(batch[i]) - base_value_;
+                }
+            });
+        }
+        timings.reprice_ms += elapsed_ms(stage_start);
+
+        stage_start = Clock::now();
+        for (std::size_t i = 0; i < count; ++i) {
+            const double pnl = batch_pnl[i];
+            if (!expected) {
+                losses.push_back(pnl);
+            } else if (losses.size() < keep) {
+                losses.push_back(pnl);
+                std::push_heap(losses.begin(), losses.end());
+            } else if (pnl < losses.front()) {
+                std::pop_heap(losses.begin(), losses.end());
+                losses.back() = pnl;
+                std::push_heap(losses.begin(), losses.end());
+            }
+        }
+        n += count;
+        timings.select_ms += elapsed_ms(stage_start);
+    }
+
+    if (n == 0) {
+        throw std::runtime_error("No scenarios found for VaR calculation");
+    }
+    if (expected && n != *expected) {
+        throw std::runtime_error("Scenario input changed while it was being read");
+    }
+
+    const auto select_start = Clock::now();
+    const Tracing::TraceSpan select_span("select_quantile", "batch", static_cast<std::int64_t>(losses.size()));
+    timer.set_items(n);
+    const std::size_t tail = tail_count(n, config_.confidence);
+
+    // Largest losses are the most negative PnL values: partition them to the front
+    const auto nth = losses.begin() + static_cast<std::ptrdiff_t>(tail - 1);
+    std::nth_element(losses.begin(), nth, losses.end());
+    const double var = -*nth;
+    const double tail_pnl = std::accumulate(losses.begin(), nth + 1, 0.0);
+    timings.select_ms += elapsed_ms(select_start);
+
+    return VaRResult{
+        .value_at_risk = var,
+        .expected_shortfall = -tail_pnl / static_cast<double>(tail),
+        .base_value = base_value_,
+        .scenarios = n,
+        .timings = timings
+    };
+}
+
+VaRResult VaREngine::run_file(const std::string& path, std::pmr::memory_resource* resource) const {
+    std::ifstream input(path);
+    if (!input) {
+        throw std::runtime_error("Cannot open scenario file: " + path);
+    }
+    return run(input, resource);
+}
+
+double VaREngine::scenario_value(const Scenario& scenario) const {
+    const double horizon = config_.horizon_days / 365.25;
+    double value = 0.0;
+
+    for (const Position& position : book_) {
+        if (position.underlying >= scenario.spot_returns.size()) {
+            throw std::runtime_error("Scenario has no spot return for a book underlying");
+        }
+        const OptionParameters& p = position.params;
+        value += position_value(position,
+                                p.underlying_price * std::exp(scenario.spot_returns[position.underlying]),
+                                p.time_to_expiration - horizon,
+                                p.risk_free_rate + scenario.rate_shift,
+                                std::max(1e-6, p.volatility + scenario.volatility_shift));
+    }
+
+    return value;
+}
+
+double VaREngine::position_value(const Position& position, double S, double T, double r, double sigma) {
+    const double K = position.params.strike_price;
+
+    // Options expiring within the horizon are worth their intrinsic value
+    if (T <= 0.0) {
+        const double intrinsic = position.type == OptionType::Call
+            ? std::max(0.0, S - K)
+            : std::max(0.0, K - S);
+        return position.quantity * intrinsic;
+    }
+
+    const OptionParameters shocked(S, K, T, r, sigma, position.params.dividend_yield);
+    const double price = position.type == OptionType::Call
+        ? Model::call_price(shocked)
+        : Model::put_price(shocked);
+    return position.quantity * price;
+}
+
+} // namespace BlackScholes
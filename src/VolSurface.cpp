@@ -0,0 +1,202 @@
+#include "VolSurface.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace BlackScholes {
+
+VolSurface::VolSurface(std::vector<double> strikes,
+                       std::vector<double> expiries,
+                       std::span<const double> volatilities,
+                       VolInterpolation method)
+    : strikes_(std::move(strikes))
+    , method_(method)
+{
+    const std::size_t n_strikes = strikes_.size();
+    const std::size_t n_expiries = expiries.size();
+
+    if (n_strikes < 2 || n_expiries < 1) {
+        throw std::invalid_argument("Volatility surface needs at least two strikes and one expiry");
+    }
+    if (volatilities.size() != n_strikes * n_expiries) {
+        throw std::invalid_argument("Volatility grid size does not match strikes × expiries");
+    }
+    for (std::size_t j = 0; j < n_strikes; ++j) {
+        if (!std::isfinite(strikes_[j]) || (j > 0 && !(strikes_[j] > strikes_[j - 1]))) {
+            throw std::invalid_argument("Volatility surface strikes must be strictly increasing");
+        }
+    }
+    for (std::size_t i = 0; i < n_expiries; ++i) {
+        if (!(expiries[i] > 0.0) || !std::isfinite(expiries[i])
+            || (i > 0 && !(expiries[i] > expiries[i - 1]))) {
+            throw std::invalid_argument("Volatility surface expiries must be positive and strictly increasing");
+        }
+    }
+
+    slices_.reserve(n_expiries);
+    for (std::size_t i = 0; i < n_expiries; ++i) {
+        Slice slice;
+        slice.expiry = expiries[i];
+        slice.variance.resize(n_strikes);
+        for (std::size_t j = 0; j < n_strikes; ++j) {
+            const double sigma = volatilities[i * n_strikes + j];
+            if (!(sigma > 0.0) || !std::isfinite(sigma)) {
+                throw std::invalid_argument("Volatility surface entries must be positive");
+            }
+            slice.variance[j] = sigma * sigma * slice.expiry;
+        }
+
+        slice.second_derivative = method_ == VolInterpolation::CubicSpline
+            ? spline_second_derivatives(slice.variance)
+            : std::vector<double>(n_strikes, 0.0);
+        slices_.push_back(std::move(slice));
+    }
+}
+
+double VolSurface::volatility(double strike, double expiry) const noexcept {
+    // Bracketing slices and their weights in total variance
+    const auto upper = std::upper_bound(slices_.begin(), slices_.end(), expiry,
+        [](double t, const Slice& s) { return t < s.expiry; });
+    const std::size_t segment = find_segment(strike);
+
+    double variance;
+    if (upper == slices_.begin()) {
+        variance = slice_variance(slices_.front(), segment, strike) * expiry / slices_.front().expiry;
+    } else if (upper == slices_.end()) {
+        variance = slice_variance(slices_.back(), segment, strike) * expiry / slices_.back().expiry;
+    } else {
+        const Slice& lo = *(upper - 1);
+        const Slice& hi = *upper;
+        const double weight = (expiry - lo.expiry) / (hi.expiry - lo.expiry);
+        variance = (1.0 - weight) * slice_variance(lo, segment, strike)
+                 + weight * slice_variance(hi, segment, strike);
+    }
+
+    return std::sqrt(std::max(variance, 0.0) / expiry);
+}
+
+void VolSurface::lookup_batch(std::span<const double> strikes,
+                              std::span<const double> expiries,
+                              std::span<double> out,
+                              std::pmr::memory_resource* resource) const {
+    if (strikes.size() != expiries.size() || out.size() != strikes.size()) {
+        throw std::invalid_argument("Mismatched volatility lookup sizes");
+    }
+
+    const std::size_t n = strikes.size();
+    std::pmr::vector<double> variance(n > 0 ? strikes_.size() : 0, resource);
+    std::pmr::vector<double> second_derivative(variance.size(), resource);
+    double slice_expiry = 0.0;
+    std::size_t segment = 0;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const double K = strikes[i];
+        const double T = expiries[i];
+
+        if (i == 0 || T != slice_expiry) {
+            // New expiry run: blend one slice and restart the strike cursor
+            blend_slice(T, variance, second_derivative);
+            slice_expiry = T;
+            segment = find_segment(K);
+        } else if (K >= strikes_[segment]) {
+            // Sorted strikes: advance the cursor instead of searching
+            while (segment + 2 < strikes_.size() && K >= strikes_[segment + 1]) {
+                ++segment;
+            }
+        } else {
+            segment = find_segment(K);
+        }
+
+        out[i] = std::sqrt(std::max(slice_variance(variance, second_derivative, segment, K), 0.0) / T);
+    }
+}
+
+VolSurface::Slice VolSurface::slice_at(double expiry) const {
+    Slice slice;
+    slice.expiry = expiry;
+    slice.variance.resize(strikes_.size());
+    slice.second_derivative.resize(strikes_.size());
+    blend_slice(expiry, slice.variance, slice.second_derivative);
+    return slice;
+}
+
+void VolSurface::blend_slice(double expiry, std::span<double> variance,
+                             std::span<double> second_derivative) const noexcept {
+    const auto upper = std::upper_bound(slices_.begin(), slices_.end(), expiry,
+        [](double t, const Slice& s) { return t < s.expiry; });
+
+    const Slice* lo;
+    const Slice* hi;
+    double w_lo;
+    double w_hi;
+    if (upper == slices_.begin()) {
+        lo = hi = &slices_.front();
+        w_lo = expiry / lo->expiry;
+        w_hi = 0.0;
+    } else if (upper == slices_.end()) {
+        lo = hi = &slices_.back();
+        w_lo = expiry / lo->expiry;
+        w_hi = 0.0;
+    } else {
+        lo = &*(upper - 1);
+        hi = &*upper;
+        w_hi = (expiry - lo->expiry) / (hi->expiry - lo->expiry);
+        w_lo = 1.0 - w_hi;
+    }
+
+    // A linear combination of splines is a spline, so the second derivatives blend too
+    const std::size_t n = strikes_.size();
+    for (std::size_t j = 0; j < n; ++j) {
+        variance[j] = w_lo * lo->variance[j] + w_hi * hi->variance[j];
+        second_derivative[j] = w_lo * lo->second_derivative[j] + w_hi * hi->second_derivative[j];
+    }
+}
+
+std::size_t VolSurface::find_segment(double strike) const noexcept {
+    const auto it = std::upper_bound(strikes_.begin(), strikes_.end(), strike);
+    const auto index = static_cast<std::size_t>(std::distance(strikes_.begin(), it));
+    return std::clamp<std::size_t>(index, 1, strikes_.size() - 1) - 1;
+}
+
+double VolSurface::slice_variance(std::span<const double> variance,
+                                  std::span<const double> second_derivative,
+                                  std::size_t segment, double strike) const noexcept {
+    const double k_lo = strikes_[segment];
+    const double k_hi = strikes_[segment + 1];
+    const double K = std::clamp(strike, strikes_.front(), strikes_.back()); // Flat extrapolation
+
+    const double h = k_hi - k_lo;
+    const double a = (k_hi - K) / h;
+    const double b = 1.0 - a;
+    double w = a * variance[segment] + b * variance[segment + 1];
+
+    if (method_ == VolInterpolation::CubicSpline) {
+        w += ((a * a * a - a) * second_derivative[segment]
+            + (b * b * b - b) * second_derivative[segment + 1]) * h * h / 6.0;
+    }
+    return w;
+}
+
+std::vector<double> VolSurface::spline_second_derivatives(const std::vector<double>& values) const {
+    // Natural spline: tridiagonal solve with zero curvature at both ends
+    const std::size_t n = strikes_.size();
+    std::vector<double> y2(n, 0.0);
+    std::vector<double> u(n, 0.0);
+
+    for (std::size_t j = 1; j + 1 < n; ++j) {
+        const double sig = (strikes_[j] - strikes_[j - 1]) / (strikes_[j + 1] - strikes_[j - 1]);
+        const double p = sig * y2[j - 1] + 2.0;
+        y2[j] = (sig - 1.0) / p;
+        const double slope_diff = (values[j + 1] - values[j]) / (strikes_[j + 1] - strikes_[j])
+                                - (values[j] - values[j - 1]) / (strikes_[j] - strikes_[j - 1]);
+        u[j] = (6.0 * slope_diff / (strikes_[j + 1] - strikes_[j - 1]) - sig * u[j - 1]) / p;
+    }
+
+    y2[n - 1] = 0.0;
+    for (std::size_t j = n - 1; j-- > 0;) {
+        y2[j] = y2[j] * y2[j + 1] + u[j];
+    }
+    return y2;
+}
+
+} // namespace BlackScholes
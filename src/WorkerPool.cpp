@@ -0,0 +1,86 @@
+#include "WorkerPool.hpp"
+#include "TraceEvents.hpp"
+#include <algorithm>
+
+namespace BlackScholes {
+
+WorkerPool::WorkerPool(unsigned workers, const char* thread_name)
+    : thread_name_(thread_name) {
+    if (workers == 0) {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    errors_.resize(workers);
+    threads_.reserve(workers - 1);
+    for (unsigned w = 1; w < workers; ++w) {
+        threads_.emplace_back([this, w](std::stop_token stop) { work(stop, w); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    for (auto& thread : threads_) {
+        thread.request_stop();
+    }
+    threads_.clear();
+}
+
+void WorkerPool::run_job(Job job, void* context) {
+    if (threads_.empty()) {
+        job(context, 0);
+        return;
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        job_ = job;
+        context_ = context;
+        remaining_ = static_cast<unsigned>(threads_.size());
+        ++generation_;
+    }
+    start_.notify_all();
+
+    try {
+        job(context, 0);
+    } catch (...) {
+        errors_[0] = std::current_exception();
+    }
+
+    {
+        std::unique_lock lock(mutex_);
+        done_.wait(lock, [this] { return remaining_ == 0; });
+    }
+
+    for (auto& error : errors_) {
+        if (error) {
+            const std::exception_ptr first = error;
+            std::fill(errors_.begin(), errors_.end(), nullptr);
+            std::rethrow_exception(first);
+        }
+    }
+}
+
+void WorkerPool::work(std::stop_token stop, unsigned worker) {
+    std::uint64_t seen = 0;
+    std::unique_lock lock(mutex_);
+    while (start_.wait(lock, stop, [&] { return generation_ != seen; })) {
+        seen = generation_;
+        const Job job = job_;
+        void* const context = context_;
+        lock.unlock();
+
+        if (Tracing::enabled()) {
+            Tracing::set_thread_name(thread_name_);
+        }
+        try {
+            job(context, worker);
+        } catch (...) {
+            errors_[worker] = std::current_exception();
+        }
+
+        lock.lock();
+        if (--remaining_ == 0) {
+            done_.notify_one();
+        }
+    }
+}
+
+} // namespace BlackScholes
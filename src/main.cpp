@@ -18,10 +18,18 @@
  */
 
 #include "OptionPricerGUI.hpp"
+#include "Instrumentation.hpp"
+#include "TraceEvents.hpp"
 #include <GLFW/glfw3.h>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 
 // OpenGL debug callback (simplified for compatibility)
 #ifdef _DEBUG
@@ -105,6 +113,77 @@ std::unique_ptr<GLFWwindow, void(*)(GLFWwindow*)> create_window(int width, int h
     return window;
 }
 
+/**
+ * @brief Parse a TCP port number
+ * @param text Decimal port, 0 to 65535
+ * @return The port, or std::nullopt if text is not a valid port
+ */
+std::optional<std::uint16_t> parse_port(std::string_view text) {
+    unsigned long value = 0;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc() || end != text.data() + text.size() || value > 65535) {
+        return std::nullopt;
+    }
+    return static_cast<std::uint16_t>(value);
+}
+
+/**
+ * @brief Opt-in metrics export configured from the environment
+ *
+ * BLACKSCHOLES_METRICS_FILE=path rewrites a Prometheus textfile every few
+ * seconds and on exit; BLACKSCHOLES_METRICS_PORT=port serves the same text
+ * over HTTP on localhost. Recording stays off when neither is set. Export
+ * problems are reported on stderr and never stop the application.
+ */
+struct MetricsExport {
+    std::string file_path;
+    std::optional<BlackScholes::Instrumentation::MetricsServer> server;
+    double last_export_time = 0.0;
+
+    MetricsExport() {
+        if (const char* path = std::getenv("BLACKSCHOLES_METRICS_FILE")) {
+            file_path = path;
+        }
+        if (const char* port_text = std::getenv("BLACKSCHOLES_METRICS_PORT")) {
+            if (const auto port = parse_port(port_text)) {
+                try {
+                    server.emplace(*port);
+                    std::cout << "Serving metrics on http://127.0.0.1:" << server->port() << "/metrics" << std::endl;
+                } catch (const std::exception& e) {
+                    std::cerr << "Metrics server disabled: " << e.what() << std::endl;
+                }
+            } else {
+                std::cerr << "Ignoring BLACKSCHOLES_METRICS_PORT=" << port_text
+                          << ": expected a port number from 0 to 65535" << std::endl;
+            }
+        }
+        BlackScholes::Instrumentation::set_enabled(!file_path.empty() || server.has_value());
+    }
+
+    void tick(double now) {
+        constexpr double export_interval_seconds = 5.0;
+        if (!file_path.empty() && now - last_export_time >= export_interval_seconds) {
+            // A failed export is retried at the next interval
+            last_export_time = now;
+            try {
+                BlackScholes::Instrumentation::export_prometheus(file_path);
+            } catch (const std::exception& e) {
+                std::cerr << "Metrics export failed: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    ~MetricsExport() {
+        if (!file_path.empty()) {
+            try {
+                BlackScholes::Instrumentation::export_prometheus(file_path);
+            } catch (const std::exception& e) {
+                std::cerr << "Metrics export failed: " << e.what() << std::endl;
+            }
+        }
+    }
+};
+
 /**
  * @brief Main application entry point
  */
@@ -132,7 +211,16 @@ int main() {
         
         GUI::GuiContext gui_context(window.get(), glsl_version);
         
+        // Opt-in timeline trace, written when the session ends
+        std::optional<BlackScholes::Tracing::TraceSession> trace;
+        if (const char* trace_path = std::getenv("BLACKSCHOLES_TRACE_FILE")) {
+            trace.emplace(trace_path);
+            BlackScholes::Tracing::set_thread_name("main");
+            std::cout << "Recording trace to " << trace_path << std::endl;
+        }
+        
         // Create main application
+        MetricsExport metrics;
         GUI::OptionPricerGUI app;
         
         std::cout << "Application initialized successfully!" << std::endl;
@@ -163,6 +251,8 @@ int main() {
             gui_context.render();
             
             glfwSwapBuffers(window.get());
+            
+            metrics.tick(glfwGetTime());
         }
         
         std::cout << "Application shutting down gracefully..." << std::endl;
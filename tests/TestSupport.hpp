@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cmath>
+#include <iostream>
+
+/**
+ * @file TestSupport.hpp
+ * @brief Helpers shared by the standalone check executables
+ */
+
+namespace Testing {
+
+/**
+ * @brief When check() prints its comparison
+ */
+enum class Report {
+    Failures, ///< Only comparisons outside the tolerance
+    Always    ///< Every comparison, for tests whose output is the record of what was checked
+};
+
+/**
+ * @brief Compare a value with its reference to an absolute tolerance
+ * @param name Label printed with the comparison
+ * @param value Value under test
+ * @param reference Expected value
+ * @param tolerance Largest accepted absolute error
+ * @param report Whether a passing comparison is printed as well
+ * @return True when |value - reference| ≤ tolerance
+ */
+inline bool check(const char* name, double value, double reference, double tolerance,
+                  Report report = Report::Failures) {
+    const double error = std::abs(value - reference);
+    const bool ok = error <= tolerance;
+    if (!ok || report == Report::Always) {
+        std::cout << name << ": " << value << " vs " << reference << ", error " << error << '\n';
+    }
+    return ok;
+}
+
+} // namespace Testing
@@ -0,0 +1,19 @@
+/**
+ * @file accuracy_check.cpp
+ * @brief Audit every pricing backend against the extended-precision reference
+ *
+ * Prints the error report and fails when any backend exceeds its declared
+ * tolerance.
+ */
+
+#include "AccuracyHarness.hpp"
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+    namespace Accuracy = BlackScholes::Accuracy;
+    const Accuracy::Grid grid = Accuracy::make_grid();
+    const Accuracy::Report report = Accuracy::run(grid, Accuracy::default_backends());
+    Accuracy::write_report(std::cout, report, grid);
+    return report.passed() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
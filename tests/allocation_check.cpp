@@ -0,0 +1,253 @@
+/**
+ * @file allocation_check.cpp
+ * @brief Warmed-up hot paths make no allocations from their memory resource
+ *
+ * Curve generation, Heston slices, volatility surface lookups and warm SVI,
+ * SSVI and SABR recalibrations into a reused ScratchArena, Carr-Madan
+ * transforms on their constructed buffers, PricerModel::update(), both idle
+ * and repricing at unchanged sizes, and the view's decimated plot series are
+ * run against a CountingResource; once warmed up, further calls must not
+ * allocate.
+ */
+
+#include "BlackScholesModel.hpp"
+#include "CarrMadanFft.hpp"
+#include "HestonModel.hpp"
+#include "MemoryArena.hpp"
+#include "PlotDecimation.hpp"
+#include "PricerModel.hpp"
+#include "SabrModel.hpp"
+#include "SviCalibration.hpp"
+#include "VolSurface.hpp"
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int repeat_count = 100;
+
+bool expect_no_allocations(std::string_view name, std::size_t before, std::size_t after) {
+    std::cout << name << ": " << (after - before) << " allocations over " << repeat_count << " calls\n";
+    return after == before;
+}
+
+// Updates the model until the background refinement of its curve has been adopted
+void settle(GUI::PricerModel& model) {
+    model.update();
+    while (model.curve().refining()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        model.update();
+    }
+}
+
+bool check_price_curve() {
+    BlackScholes::CountingResource heap;
+    BlackScholes::ScratchArena arena(4 * 1024, &heap);
+    const BlackScholes::OptionParameters params(100.0, 105.0, 1.0, 0.05, 0.2);
+
+    auto generate = [&] {
+        const auto curve = BlackScholes::Model::generate_price_curve(params, 50.0, 2000, &arena);
+        arena.reset();
+        return curve.size();
+    };
+
+    // The first cycle spills past the block; the reset regrows it to fit
+    generate();
+    const std::size_t before = heap.allocations();
+    for (int i = 0; i < repeat_count; ++i) {
+        generate();
+    }
+    return expect_no_allocations("generate_price_curve", before, heap.allocations());
+}
+
+bool check_heston_slice() {
+    BlackScholes::CountingResource heap;
+    BlackScholes::ScratchArena arena(4 * 1024, &heap);
+    const BlackScholes::HestonCosPricer pricer(BlackScholes::HestonParameters{
+        .kappa = 1.5, .theta = 0.04, .vol_of_vol = 0.5, .rho = -0.6, .initial_variance = 0.04});
+    const BlackScholes::OptionParameters base(100.0, 100.0, 1.0, 0.03, 0.2);
+    std::array<double, 64> strikes{};
+    for (std::size_t j = 0; j < strikes.size(); ++j) {
+        strikes[j] = 70.0 + static_cast<double>(j);
+    }
+    std::array<double, 64> calls{};
+    std::array<double, 64> puts{};
+
+    auto price = [&] {
+        pricer.price_slice(base, strikes, calls, puts, &arena);
+        arena.reset();
+    };
+
+    price();
+    const std::size_t before = heap.allocations();
+    for (int i = 0; i < repeat_count; ++i) {
+        price();
+    }
+    return expect_no_allocations("HestonCosPricer::price_slice", before, heap.allocations());
+}
+
+bool check_vol_lookup() {
+    BlackScholes::CountingResource heap;
+    BlackScholes::ScratchArena arena(1024, &heap);
+    const std::array<double, 6> vols{0.25, 0.22, 0.21, 0.23, 0.21, 0.20};
+    const BlackScholes::VolSurface surface({80.0, 100.0, 120.0}, {0.5, 1.0}, vols,
+                                           BlackScholes::VolInterpolation::CubicSpline);
+    const std::array<double, 4> strikes{85.0, 95.0, 105.0, 115.0};
+    const std::array<double, 4> expiries{0.75, 0.75, 0.75, 0.75};
+    std::array<double, 4> out{};
+
+    auto lookup = [&] {
+        surface.lookup_batch(strikes, expiries, out, &arena);
+        arena.reset();
+    };
+
+    lookup();
+    const std::size_t before = heap.allocations();
+    for (int i = 0; i < repeat_count; ++i) {
+        lookup();
+    }
+    return expect_no_allocations("VolSurface::lookup_batch", before, heap.allocations());
+}
+
+// The calibrators take their scratch on the calling thread, so an arena is safe even with workers
+bool check_calibration() {
+    BlackScholes::CountingResource heap;
+    BlackScholes::ScratchArena arena(16 * 1024, &heap);
+    const BlackScholes::SviParameters svi{.a = 0.01, .b = 0.05, .rho = -0.4, .m = 0.02, .sigma = 0.15};
+    const BlackScholes::SabrParameters sabr{.alpha = 0.3, .beta = 0.5, .rho = -0.3, .nu = 0.6};
+    std::vector<BlackScholes::SviSlice> svi_slices;
+    std::vector<BlackScholes::SabrSlice> sabr_slices;
+    for (const double T : {0.25, 0.5, 1.0, 2.0}) {
+        BlackScholes::SviSlice svi_slice{.expiry = T, .forward = 100.0, .strikes = {}, .volatilities = {}, .weights = {}};
+        BlackScholes::SabrSlice sabr_slice{.expiry = T, .forward = 100.0, .strikes = {}, .volatilities = {}, .weights = {}};
+        for (int j = -5; j <= 5; ++j) {
+            const double K = 100.0 * std::exp(0.05 * j);
+            svi_slice.strikes.push_back(K);
+            svi_slice.volatilities.push_back(std::sqrt(svi.total_variance(0.05 * j)));
+            sabr_slice.strikes.push_back(K);
+        }
+        sabr_slice.volatilities.resize(sabr_slice.strikes.size());
+        BlackScholes::Sabr::implied_volatility_batch(sabr, 100.0, T, sabr_slice.strikes, sabr_slice.volatilities);
+        svi_slices.push_back(std::move(svi_slice));
+        sabr_slices.push_back(std::move(sabr_slice));
+    }
+    const std::vector<double> grid{80.0, 90.0, 100.0, 110.0, 120.0};
+    BlackScholes::SviCalibrator svi_calibrator(BlackScholes::CalibrationConfig{.num_threads = 2});
+    BlackScholes::SabrCalibrator sabr_calibrator(0.5, BlackScholes::CalibrationConfig{.num_threads = 2});
+
+    auto calibrate = [&] {
+        (void)svi_calibrator.calibrate_ssvi(svi_slices, &arena);
+        (void)svi_calibrator.svi_surface(grid, BlackScholes::VolInterpolation::CubicSpline, &arena);
+        (void)sabr_calibrator.calibrate(sabr_slices, &arena);
+        arena.reset();
+    };
+
+    calibrate();
+    const std::size_t before = heap.allocations();
+    for (int i = 0; i < repeat_count; ++i) {
+        calibrate();
+    }
+    return expect_no_allocations("SVI, SSVI and SABR recalibration", before, heap.allocations());
+}
+
+bool check_carr_madan() {
+    BlackScholes::CountingResource heap;
+    BlackScholes::CarrMadanPricer pricer(BlackScholes::FftGrid{}, &heap);
+    const BlackScholes::OptionParameters base(100.0, 100.0, 1.0, 0.03, 0.2, 0.01);
+    const BlackScholes::BlackScholesCharacteristic phi{.volatility = 0.2, .time = 1.0, .carry = 0.02};
+    const std::array<double, 4> strikes{80.0, 95.0, 105.0, 130.0};
+    std::array<double, 4> calls{};
+    std::array<double, 4> puts{};
+
+    const std::size_t before = heap.allocations();
+    for (int i = 0; i < repeat_count; ++i) {
+        pricer.price_strikes(phi, base, strikes, calls, puts);
+    }
+    return expect_no_allocations("CarrMadanPricer::price_strikes", before, heap.allocations())
+        && heap.allocations() == 3;
+}
+
+bool check_pricer_model() {
+    BlackScholes::CountingResource heap;
+    GUI::PricerModel model(&heap);
+    model.inputs().plot_points = 100000;
+    model.inputs().surface_points = 64;
+    model.set_surface_visible(true);
+
+    // Two repricings so both the front and back curve buffers reach full size
+    settle(model);
+    model.invalidate_prices();
+    settle(model);
+    if (!model.results_valid() || model.curve().size() != 100000 || model.surface().empty()) {
+        std::cout << "PricerModel: warm-up did not produce results\n";
+        return false;
+    }
+
+    bool passed = true;
+    std::size_t before = heap.allocations();
+    for (int i = 0; i < repeat_count; ++i) {
+        model.update();
+    }
+    passed &= expect_no_allocations("PricerModel::update, idle", before, heap.allocations());
+
+    // Dragging an input reprices everything at the same sizes
+    before = heap.allocations();
+    for (int i = 0; i < repeat_count; ++i) {
+        model.inputs().volatility = 0.2f + 0.001f * static_cast<float>(i);
+        model.invalidate_prices();
+        settle(model);
+    }
+    passed &= expect_no_allocations("PricerModel::update, repricing", before, heap.allocations());
+    return passed;
+}
+
+bool check_view_series() {
+    BlackScholes::CountingResource heap;
+    GUI::PricerModel model(&heap);
+    model.inputs().plot_points = 100000;
+    settle(model);
+
+    // What the view draws every frame: the curve decimated to the plot width
+    GUI::DecimatedSeries series(&heap);
+    const auto x = model.curve().underlying();
+    const auto y = model.curve().call();
+    constexpr int plot_width = 800;
+    series.update(x, y, model.series_version(), x.front(), x.back(), plot_width);
+
+    bool passed = true;
+    std::size_t before = heap.allocations();
+    for (int i = 0; i < repeat_count; ++i) {
+        model.update();
+        series.update(x, y, model.series_version(), x.front(), x.back(), plot_width);
+    }
+    passed &= expect_no_allocations("DecimatedSeries::update, unchanged view", before, heap.allocations());
+
+    // Panning rebuilds the series every frame at the same resolution
+    before = heap.allocations();
+    for (int i = 0; i < repeat_count; ++i) {
+        const double shift = 0.1 * static_cast<double>(i);
+        series.update(x, y, model.series_version(), x.front() + shift, x.back() - 10.0 + shift, plot_width);
+    }
+    passed &= expect_no_allocations("DecimatedSeries::update, panning", before, heap.allocations());
+    return passed;
+}
+
+} // namespace
+
+int main() {
+    bool passed = check_price_curve();
+    passed &= check_heston_slice();
+    passed &= check_vol_lookup();
+    passed &= check_calibration();
+    passed &= check_carr_madan();
+    passed &= check_pricer_model();
+    passed &= check_view_series();
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file bachelier_check.cpp
+ * @brief Bachelier Greeks and normal implied volatility
+ *
+ * Greeks are compared with central finite differences of the price.
+ * Out-of-the-money quotes priced by the model must give back their σ_N,
+ * and the inverter's edge cases hold: prices below intrinsic value give
+ * NaN, at the money too, and a price at intrinsic value that rounds a few
+ * ulp below it gives 0.
+ */
+
+#include "BachelierModel.hpp"
+#include "TestSupport.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+using namespace BlackScholes;
+using Testing::check;
+
+} // namespace
+
+int main() {
+    std::cout.precision(10);
+    bool passed = true;
+
+    // Greeks in OptionPrices units: per unit F, per 0.01 σ_N, per day, per 1% rate
+    for (const double F : {-0.005, 0.01, 0.03}) {
+        const double K = 0.01;
+        const double T = 1.5;
+        const double r = 0.02;
+        const double sigma = 0.008;
+        const OptionPrices g = Bachelier::price(F, K, T, r, sigma);
+        const auto call = [](const Kernel::OptionValues& v) { return v.call_price; };
+        const auto put = [](const Kernel::OptionValues& v) { return v.put_price; };
+        const auto diff = [](auto leg, const Kernel::OptionValues& up, const Kernel::OptionValues& down, double h) {
+            return (leg(up) - leg(down)) / (2.0 * h);
+        };
+
+        const double hF = 1e-6;
+        const auto F_up = Bachelier::value(F + hF, K, T, r, sigma);
+        const auto F_mid = Bachelier::value(F, K, T, r, sigma);
+        const auto F_down = Bachelier::value(F - hF, K, T, r, sigma);
+        passed &= check("delta call", g.delta_call, diff(call, F_up, F_down, hF), 1e-8);
+        passed &= check("delta put", g.delta_put, diff(put, F_up, F_down, hF), 1e-8);
+        passed &= check("gamma", g.gamma, (F_up.call_price - 2.0 * F_mid.call_price + F_down.call_price) / (hF * hF),
+                        1e-4 * g.gamma);
+
+        const double hs = 1e-6;
+        const auto s_up = Bachelier::value(F, K, T, r, sigma + hs);
+        const auto s_down = Bachelier::value(F, K, T, r, sigma - hs);
+        passed &= check("vega", g.vega, diff(call, s_up, s_down, hs) / 100.0, 1e-10);
+        passed &= check("vega put", g.vega, diff(put, s_up, s_down, hs) / 100.0, 1e-10);
+
+        const double hT = 1e-5;
+        const auto T_up = Bachelier::value(F, K, T + hT, r, sigma);
+        const auto T_down = Bachelier::value(F, K, T - hT, r, sigma);
+        passed &= check("theta call", g.theta_call, -diff(call, T_up, T_down, hT) / 365.25, 1e-11);
+        passed &= check("theta put", g.theta_put, -diff(put, T_up, T_down, hT) / 365.25, 1e-11);
+
+        const double hr = 1e-6;
+        const auto r_up = Bachelier::value(F, K, T, r + hr, sigma);
+        const auto r_down = Bachelier::value(F, K, T, r - hr, sigma);
+        passed &= check("rho call", g.rho_call, diff(call, r_up, r_down, hr) / 100.0, 1e-11);
+        passed &= check("rho put", g.rho_put, diff(put, r_up, r_down, hr) / 100.0, 1e-11);
+    }
+    std::cout << "Greeks match finite differences: " << (passed ? "yes" : "no") << '\n';
+
+    // Round trip on out-of-the-money calls above the forward and puts below it
+    int round_trips = 0;
+    double worst = 0.0;
+    for (const double F : {-0.01, 0.0, 0.02}) {
+        for (const double sigma : {0.002, 0.01}) {
+            for (const double T : {0.25, 1.0, 5.0}) {
+                const double sd = sigma * std::sqrt(T);
+                for (const double moves : {0.1, 0.5, 1.0, 2.0, 3.0}) {
+                    for (const OptionType type : {OptionType::Call, OptionType::Put}) {
+                        const double K = type == OptionType::Call ? F + moves * sd : F - moves * sd;
+                        const Kernel::OptionValues v = Bachelier::value(F, K, T, 0.01, sigma);
+                        const double price = type == OptionType::Call ? v.call_price : v.put_price;
+                        const double implied = Bachelier::implied_volatility(price, F, K, T, 0.01, type);
+                        worst = std::max(worst, std::abs(implied - sigma) / sigma);
+                        passed &= check("round trip", implied, sigma, 1e-10 * sigma);
+                        ++round_trips;
+                    }
+                }
+            }
+        }
+    }
+    std::cout << round_trips << " out-of-the-money round trips, worst relative error " << worst << '\n';
+
+    // At the money the inverter is exact and must still reject negative prices
+    const double atm = Bachelier::value(0.01, 0.01, 2.0, 0.01, 0.008).call_price;
+    passed &= check("at the money", Bachelier::implied_volatility(atm, 0.01, 0.01, 2.0, 0.01, OptionType::Call),
+                    0.008, 1e-15);
+    const double negative = Bachelier::implied_volatility(-0.001, 0.01, 0.01, 1.0, 0.01, OptionType::Call);
+    std::cout << "negative at-the-money price: " << negative << '\n';
+    passed &= std::isnan(negative);
+
+    // Below intrinsic value by far more than rounding
+    const double below = Bachelier::implied_volatility(0.04, 0.0, 0.05, 1.0, 0.0, OptionType::Put);
+    std::cout << "price below intrinsic: " << below << '\n';
+    passed &= std::isnan(below);
+
+    // Deep in the money the pricer returns the discounted intrinsic value, up to rounding
+    const double deep = Bachelier::value(0.0, 0.05, 1.0, 0.01, 0.001).put_price;
+    const double at_intrinsic = Bachelier::implied_volatility(deep, 0.0, 0.05, 1.0, 0.01, OptionType::Put);
+    std::cout << "price at intrinsic: " << at_intrinsic << '\n';
+    passed &= at_intrinsic == 0.0;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file chebyshev_check.cpp
+ * @brief Chebyshev proxy stays within its measured error and survives save/load
+ *
+ * Fits a Black-Scholes call over a moneyness, expiry and volatility box at
+ * several degrees, compares the proxy with the pricer at random points in
+ * the box against max_error(), and checks that a saved and reloaded proxy
+ * evaluates identically.
+ */
+
+#include "BlackScholesModel.hpp"
+#include "ChebyshevProxy.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+int main() {
+    using namespace BlackScholes;
+    bool passed = true;
+
+    // Call price per unit strike as a function of S/K
+    const ChebyshevProxy::Pricer call = [](double moneyness, double time, double volatility) {
+        return Model::call_price(OptionParameters(moneyness, 1.0, time, 0.03, volatility));
+    };
+    const ChebyshevBox box{.moneyness_min = 0.8, .moneyness_max = 1.2, .time_min = 0.1, .time_max = 1.0,
+                           .volatility_min = 0.1, .volatility_max = 0.4};
+
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> moneyness(box.moneyness_min, box.moneyness_max);
+    std::uniform_real_distribution<double> time(box.time_min, box.time_max);
+    std::uniform_real_distribution<double> volatility(box.volatility_min, box.volatility_max);
+
+    for (const int n : {6, 10, 16}) {
+        const ChebyshevProxy proxy = ChebyshevProxy::build(call, box, {n, n, n});
+        double worst = 0.0;
+        for (int s = 0; s < 100000; ++s) {
+            const double m = moneyness(rng);
+            const double t = time(rng);
+            const double v = volatility(rng);
+            worst = std::max(worst, std::abs(proxy.evaluate(m, t, v) - call(m, t, v)));
+        }
+        std::cout << n << " nodes: max_error " << proxy.max_error() << ", worst at random points " << worst << '\n';
+        passed &= proxy.max_error() > 0.0 && worst <= proxy.max_error();
+    }
+
+    // Save/load keeps the box, nodes, measured error and every coefficient
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "blackscholes_chebyshev_check.bin";
+    const ChebyshevProxy saved = ChebyshevProxy::build(call, box, {8, 6, 5});
+    saved.save(path.string());
+    const ChebyshevProxy loaded = ChebyshevProxy::load(path.string());
+    bool identical = loaded.nodes() == saved.nodes() && loaded.max_error() == saved.max_error()
+                  && loaded.box().moneyness_max == box.moneyness_max && loaded.box().volatility_min == box.volatility_min;
+    for (int s = 0; s < 1000; ++s) {
+        const double m = moneyness(rng);
+        const double t = time(rng);
+        const double v = volatility(rng);
+        identical &= loaded.evaluate(m, t, v) == saved.evaluate(m, t, v);
+    }
+    std::cout << "save/load round trip: " << (identical ? "identical" : "differs") << '\n';
+    passed &= identical;
+
+    // A truncated file is rejected
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - sizeof(double));
+    bool rejected = false;
+    try {
+        (void)ChebyshevProxy::load(path.string());
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    std::filesystem::remove(path);
+    std::cout << "truncated file rejected: " << (rejected ? "yes" : "no") << '\n';
+    passed &= rejected;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
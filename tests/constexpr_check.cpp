@@ -0,0 +1,53 @@
+/**
+ * @file constexpr_check.cpp
+ * @brief Compile-time math matches the runtime kernel and libm
+ *
+ * Including ConstexprMath.hpp compiles its static_assert self-checks. The
+ * runtime part compares Constexpr::erfc with std::erfc across the double
+ * range and a compile-time price table with Kernel::value.
+ */
+
+#include "ConstexprMath.hpp"
+#include "PricingKernel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+namespace Constexpr = BlackScholes::Constexpr;
+
+constexpr double table_start = 50.0;
+constexpr double table_end = 150.0;
+constexpr auto table = Constexpr::price_curve<64>(table_start, table_end, 100.0, 1.0, 0.05, 0.02, 0.2);
+
+} // namespace
+
+int main() {
+    // std::erfc is itself within an ulp or two, so the tolerance allows for both
+    double erfc_error = 0.0;
+    double erfc_worst_x = 0.0;
+    for (double x = -6.0; x < 26.5; x += 1.0 / 1024.0) {
+        const double expected = std::erfc(x);
+        const double error = std::abs(Constexpr::erfc(x) / expected - 1.0);
+        if (error > erfc_error) {
+            erfc_error = error;
+            erfc_worst_x = x;
+        }
+    }
+    std::cout << "erfc: max relative error " << erfc_error << " at x = " << erfc_worst_x << '\n';
+
+    double table_error = 0.0;
+    const double step = (table_end - table_start) / static_cast<double>(table.size() - 1);
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        const double S = table_start + static_cast<double>(i) * step;
+        const auto runtime = BlackScholes::Kernel::value<BlackScholes::BlackScholesMerton>(S, 100.0, 1.0, 0.05, 0.02, 0.2);
+        table_error = std::max({table_error, std::abs(table[i].call_price - runtime.call_price),
+                                std::abs(table[i].put_price - runtime.put_price)});
+    }
+    std::cout << "price_curve: max absolute difference " << table_error << " from Kernel::value\n";
+
+    const bool passed = erfc_error < 2e-15 && table_error < 1e-12;
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file decimation_check.cpp
+ * @brief Min/max decimation keeps the shape of the series
+ *
+ * A long noisy series with isolated spikes is decimated to a plot width.
+ * The output must stay within 2·buckets + 2 points, keep the first and last
+ * points, consist of source points in increasing x, and contain every
+ * bucket's global minimum and maximum. Series already short enough pass
+ * through unchanged, and DecimatedSeries rebuilds only when the version,
+ * the view or the width changes.
+ */
+
+#include "PlotDecimation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Check one decimation of [first, last) against the documented properties
+ */
+bool check_decimation(const std::vector<double>& x, const std::vector<double>& y,
+                      std::size_t first, std::size_t last, std::size_t buckets) {
+    std::pmr::vector<double> out_x;
+    std::pmr::vector<double> out_y;
+    GUI::decimate_min_max(x, y, first, last, buckets, out_x, out_y);
+
+    const std::size_t count = last - first;
+    bool ok = out_x.size() == out_y.size() && out_x.size() <= 2 * buckets + 2 && out_x.size() < count;
+    ok = ok && out_x.front() == x[first] && out_y.front() == y[first]
+            && out_x.back() == x[last - 1] && out_y.back() == y[last - 1];
+
+    // Source points only, in strictly increasing x (x[i] = i here)
+    for (std::size_t k = 0; ok && k < out_x.size(); ++k) {
+        const auto i = static_cast<std::size_t>(out_x[k]);
+        ok = out_y[k] == y[i] && (k == 0 || out_x[k] > out_x[k - 1]);
+    }
+
+    // Each bucket's extremes survive, found among the kept points of its x span
+    for (std::size_t b = 0; ok && b < buckets; ++b) {
+        const std::size_t begin = first + count * b / buckets;
+        const std::size_t end = first + count * (b + 1) / buckets;
+        const auto [low, high] = std::minmax_element(y.begin() + begin, y.begin() + end);
+        const auto span_begin = std::lower_bound(out_x.begin(), out_x.end(), x[begin]);
+        const auto span_end = std::upper_bound(span_begin, out_x.end(), x[end - 1]);
+        const auto kept_y = out_y.begin() + (span_begin - out_x.begin());
+        const auto kept_end = out_y.begin() + (span_end - out_x.begin());
+        ok = std::find(kept_y, kept_end, *low) != kept_end && std::find(kept_y, kept_end, *high) != kept_end;
+        if (!ok) {
+            std::cout << "  bucket " << b << " lost its min " << *low << " or max " << *high << '\n';
+        }
+    }
+
+    std::cout << "points [" << first << ", " << last << ") into " << buckets << " buckets: "
+              << out_x.size() << " kept" << (ok ? ", ok" : ", FAILED") << '\n';
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool passed = true;
+
+    // Noise with a few isolated one-point spikes in both directions
+    const std::size_t n = 100003;
+    std::vector<double> x(n);
+    std::vector<double> y(n);
+    std::mt19937_64 rng(49);
+    std::uniform_real_distribution<double> noise(-1.0, 1.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = static_cast<double>(i);
+        y[i] = std::sin(static_cast<double>(i) * 1e-4) + 0.1 * noise(rng);
+    }
+    for (const std::size_t spike : {17u, 4321u, 50000u, 99991u}) {
+        y[spike] = spike % 2 == 0 ? 25.0 : -25.0;
+    }
+
+    passed &= check_decimation(x, y, 0, n, 640);
+    passed &= check_decimation(x, y, 1234, 87654, 333);
+    passed &= check_decimation(x, y, 0, n, 1);
+
+    // Series already within two points per bucket pass through unchanged
+    std::pmr::vector<double> out_x;
+    std::pmr::vector<double> out_y;
+    GUI::decimate_min_max(x, y, 100, 740, 320, out_x, out_y);
+    bool short_ok = std::equal(out_x.begin(), out_x.end(), x.begin() + 100, x.begin() + 740)
+                 && std::equal(out_y.begin(), out_y.end(), y.begin() + 100, y.begin() + 740);
+    GUI::decimate_min_max(x, y, 10, 20, 0, out_x, out_y);
+    short_ok &= out_x.size() == 10 && out_x.front() == x[10] && out_y.back() == y[19];
+    std::cout << "short series passed through: " << (short_ok ? "ok" : "FAILED") << '\n';
+    passed &= short_ok;
+
+    // Rebuilt only when the version, view or width changes
+    GUI::DecimatedSeries series;
+    bool cache_ok = series.update(x, y, 1, 1000.5, 60000.5, 800);
+    cache_ok &= series.x().front() == 1000.0 && series.x().back() == 60001.0 && series.size() <= 2 * 800 + 2;
+    cache_ok &= !series.update(x, y, 1, 1000.5, 60000.5, 800);
+    cache_ok &= series.update(x, y, 2, 1000.5, 60000.5, 800);
+    cache_ok &= !series.update(x, y, 2, 1000.5, 60000.5, 800);
+    cache_ok &= series.update(x, y, 2, 2000.0, 60000.5, 800);
+    cache_ok &= series.update(x, y, 2, 2000.0, 60000.5, 1024);
+    cache_ok &= !series.update(x, y, 2, 2000.0, 60000.5, 1024);
+    series.invalidate();
+    cache_ok &= series.update(x, y, 2, 2000.0, 60000.5, 1024);
+    std::cout << "DecimatedSeries rebuilds only on change: " << (cache_ok ? "ok" : "FAILED") << '\n';
+    passed &= cache_ok;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file exotics_check.cpp
+ * @brief Closed-form exotics against Haug's published examples
+ *
+ * Reference values are from E. G. Haug, The Complete Guide to Option
+ * Pricing Formulas, 2nd ed.: the standard barrier table (S = 100, T = 0.5,
+ * r = 0.08, b = 0.04, rebate 3) and the worked cash-or-nothing,
+ * asset-or-nothing and geometric average-rate examples. Haug quotes four
+ * decimals, so each price must agree to one unit in the last place.
+ */
+
+#include "ExoticOptions.hpp"
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+using namespace BlackScholes;
+
+constexpr double tolerance = 1e-4;
+
+bool check(const char* name, double value, double reference) {
+    const double error = std::abs(value - reference);
+    std::cout << name << ": " << value << " vs " << reference << ", error " << error << '\n';
+    return error <= tolerance;
+}
+
+struct BarrierRow {
+    const char* name;
+    OptionType option;
+    BarrierType barrier;
+    double level;
+    double strike;
+    double at_25;  ///< Haug's price at σ = 0.25
+    double at_30;  ///< Haug's price at σ = 0.30
+};
+
+// Cost-of-carry b = r - q = 0.04; with S = H = 100 a down barrier is already hit
+constexpr std::array<BarrierRow, 36> barrier_table{{
+    {"down-and-out call", OptionType::Call, BarrierType::DownAndOut, 95.0, 90.0, 9.0246, 8.8334},
+    {"down-and-out call", OptionType::Call, BarrierType::DownAndOut, 95.0, 100.0, 6.7924, 7.0285},
+    {"down-and-out call", OptionType::Call, BarrierType::DownAndOut, 95.0, 110.0, 4.8759, 5.4137},
+    {"down-and-out call", OptionType::Call, BarrierType::DownAndOut, 100.0, 90.0, 3.0000, 3.0000},
+    {"down-and-out call", OptionType::Call, BarrierType::DownAndOut, 100.0, 100.0, 3.0000, 3.0000},
+    {"down-and-out call", OptionType::Call, BarrierType::DownAndOut, 100.0, 110.0, 3.0000, 3.0000},
+    {"up-and-out call", OptionType::Call, BarrierType::UpAndOut, 105.0, 90.0, 2.6789, 2.6341},
+    {"up-and-out call", OptionType::Call, BarrierType::UpAndOut, 105.0, 100.0, 2.3580, 2.4389},
+    {"up-and-out call", OptionType::Call, BarrierType::UpAndOut, 105.0, 110.0, 2.3453, 2.4315},
+    {"down-and-in call", OptionType::Call, BarrierType::DownAndIn, 95.0, 90.0, 7.7627, 9.0093},
+    {"down-and-in call", OptionType::Call, BarrierType::DownAndIn, 95.0, 100.0, 4.0109, 5.1370},
+    {"down-and-in call", OptionType::Call, BarrierType::DownAndIn, 95.0, 110.0, 2.0576, 2.8517},
+    {"down-and-in call", OptionType::Call, BarrierType::DownAndIn, 100.0, 90.0, 13.8333, 14.8816},
+    {"down-and-in call", OptionType::Call, BarrierType::DownAndIn, 100.0, 100.0, 7.8494, 9.2045},
+    {"down-and-in call", OptionType::Call, BarrierType::DownAndIn, 100.0, 110.0, 3.9795, 5.3043},
+    {"up-and-in call", OptionType::Call, BarrierType::UpAndIn, 105.0, 90.0, 14.1112, 15.2098},
+    {"up-and-in call", OptionType::Call, BarrierType::UpAndIn, 105.0, 100.0, 8.4482, 9.7278},
+    {"up-and-in call", OptionType::Call, BarrierType::UpAndIn, 105.0, 110.0, 4.5910, 5.8350},
+    {"down-and-in put", OptionType::Put, BarrierType::DownAndIn, 95.0, 90.0, 2.9586, 3.8769},
+    {"down-and-in put", OptionType::Put, BarrierType::DownAndIn, 95.0, 100.0, 6.5677, 7.7989},
+    {"down-and-in put", OptionType::Put, BarrierType::DownAndIn, 95.0, 110.0, 11.9752, 13.3078},
+    {"down-and-in put", OptionType::Put, BarrierType::DownAndIn, 100.0, 90.0, 2.2845, 3.3328},
+    {"down-and-in put", OptionType::Put, BarrierType::DownAndIn, 100.0, 100.0, 5.9085, 7.2636},
+    {"down-and-in put", OptionType::Put, BarrierType::DownAndIn, 100.0, 110.0, 11.6465, 12.9713},
+    {"up-and-in put", OptionType::Put, BarrierType::UpAndIn, 105.0, 90.0, 1.4653, 2.0658},
+    {"up-and-in put", OptionType::Put, BarrierType::UpAndIn, 105.0, 100.0, 3.3721, 4.4226},
+    {"up-and-in put", OptionType::Put, BarrierType::UpAndIn, 105.0, 110.0, 7.0846, 8.3686},
+    {"down-and-out put", OptionType::Put, BarrierType::DownAndOut, 95.0, 90.0, 2.2798, 2.4170},
+    {"down-and-out put", OptionType::Put, BarrierType::DownAndOut, 95.0, 100.0, 2.2947, 2.4258},
+    {"down-and-out put", OptionType::Put, BarrierType::DownAndOut, 95.0, 110.0, 2.6252, 2.6246},
+    {"down-and-out put", OptionType::Put, BarrierType::DownAndOut, 100.0, 90.0, 3.0000, 3.0000},
+    {"down-and-out put", OptionType::Put, BarrierType::DownAndOut, 100.0, 100.0, 3.0000, 3.0000},
+    {"down-and-out put", OptionType::Put, BarrierType::DownAndOut, 100.0, 110.0, 3.0000, 3.0000},
+    {"up-and-out put", OptionType::Put, BarrierType::UpAndOut, 105.0, 90.0, 3.7760, 4.2293},
+    {"up-and-out put", OptionType::Put, BarrierType::UpAndOut, 105.0, 100.0, 5.4932, 5.8032},
+    {"up-and-out put", OptionType::Put, BarrierType::UpAndOut, 105.0, 110.0, 7.5187, 7.5649},
+}};
+
+} // namespace
+
+int main() {
+    std::cout.precision(8);
+    bool passed = true;
+
+    for (const BarrierRow& row : barrier_table) {
+        const BarrierSpec spec{row.barrier, row.level, 3.0};
+        passed &= check(row.name, Exotics::barrier_price(row.option, spec, 100.0, row.strike, 0.5, 0.08, 0.04, 0.25),
+                        row.at_25);
+        passed &= check(row.name, Exotics::barrier_price(row.option, spec, 100.0, row.strike, 0.5, 0.08, 0.04, 0.30),
+                        row.at_30);
+    }
+
+    // S = 100, K = 80, T = 0.75, r = 0.06, b = 0, σ = 0.35, cash 10
+    passed &= check("cash-or-nothing put",
+                    Exotics::cash_or_nothing(100.0, 80.0, 0.75, 0.06, 0.06, 0.35, 10.0).put_price, 2.6710);
+
+    // S = 70, K = 65, T = 0.5, r = 0.07, b = 0.02, σ = 0.27
+    passed &= check("asset-or-nothing put",
+                    Exotics::asset_or_nothing(70.0, 65.0, 0.5, 0.07, 0.05, 0.27).put_price, 20.2069);
+
+    // S = 80, K = 85, T = 0.25, r = 0.05, b = 0.08, σ = 0.20
+    passed &= check("geometric average-rate put",
+                    Exotics::geometric_asian(80.0, 85.0, 0.25, 0.05, -0.03, 0.20).put_price, 4.6922);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
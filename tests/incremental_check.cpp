@@ -0,0 +1,135 @@
+/**
+ * @file incremental_check.cpp
+ * @brief Incremental ticks reprice exactly the dependent positions
+ *
+ * A small book spread over two underlyings and two discount curves takes a
+ * spot tick, a rate change and a volatility change. Each must return the
+ * positions that depend on the changed input, reprice them to
+ * Model::calculate_prices on their new parameters, and leave every other
+ * position's parameters and prices bit for bit as they were.
+ */
+
+#include "IncrementalEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <vector>
+
+namespace {
+
+using namespace BlackScholes;
+using PositionId = IncrementalEngine::PositionId;
+
+struct Snapshot {
+    std::vector<OptionParameters> params;
+    std::vector<OptionPrices> prices;
+};
+
+Snapshot snapshot(const IncrementalEngine& engine) {
+    Snapshot s;
+    for (PositionId id = 0; id < engine.size(); ++id) {
+        s.params.push_back(engine.parameters(id));
+        s.prices.push_back(engine.prices(id));
+    }
+    return s;
+}
+
+bool same_prices(const OptionPrices& a, const OptionPrices& b) {
+    return std::memcmp(&a, &b, sizeof(OptionPrices)) == 0;
+}
+
+bool same_params(const OptionParameters& a, const OptionParameters& b) {
+    return a.underlying_price == b.underlying_price && a.strike_price == b.strike_price
+        && a.time_to_expiration == b.time_to_expiration && a.risk_free_rate == b.risk_free_rate
+        && a.volatility == b.volatility && a.dividend_yield == b.dividend_yield;
+}
+
+/**
+ * @brief Every field within 1e-12 absolute or relative of calculate_prices
+ */
+bool matches_model(const OptionPrices& value, const OptionParameters& params) {
+    const OptionPrices reference = Model::calculate_prices(params);
+    for (std::size_t f = 0; f < option_field_count; ++f) {
+        const auto field = static_cast<OptionField>(f);
+        const double x = option_field_value(value, field);
+        const double expected = option_field_value(reference, field);
+        if (std::abs(x - expected) > 1e-12 * std::max(1.0, std::abs(expected))) {
+            std::cout << "  " << option_field_name(field) << ": " << x << " vs " << expected << '\n';
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief The update returned exactly `expected`, repriced them and left the rest alone
+ */
+bool check_update(const char* name, const IncrementalEngine& engine, const Snapshot& before,
+                  std::span<const PositionId> repriced, std::vector<PositionId> expected) {
+    std::vector<PositionId> returned(repriced.begin(), repriced.end());
+    std::sort(returned.begin(), returned.end());
+    std::sort(expected.begin(), expected.end());
+    bool ok = returned == expected;
+
+    for (PositionId id = 0; id < engine.size(); ++id) {
+        if (std::binary_search(expected.begin(), expected.end(), id)) {
+            ok &= matches_model(engine.prices(id), engine.parameters(id));
+        } else {
+            ok &= same_params(engine.parameters(id), before.params[id])
+               && same_prices(engine.prices(id), before.prices[id]);
+        }
+    }
+    std::cout << name << ": " << returned.size() << " repriced" << (ok ? ", ok" : ", FAILED") << '\n';
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    std::cout.precision(10);
+    bool passed = true;
+
+    IncrementalEngine engine;
+    const PositionId a_usd_1 = engine.add_position("AAA", "USD", OptionParameters(100.0, 95.0, 0.5, 0.04, 0.25, 0.01));
+    const PositionId a_usd_2 = engine.add_position("AAA", "USD", OptionParameters(100.0, 120.0, 2.0, 0.04, 0.35, 0.01));
+    const PositionId a_eur = engine.add_position("AAA", "EUR", OptionParameters(100.0, 100.0, 1.0, 0.02, 0.30, 0.01));
+    const PositionId b_usd = engine.add_position("BBB", "USD", OptionParameters(50.0, 45.0, 0.25, 0.04, 0.40, 0.0));
+    const PositionId b_eur = engine.add_position("BBB", "EUR", OptionParameters(50.0, 60.0, 3.0, 0.02, 0.20, 0.03));
+
+    bool added = true;
+    for (PositionId id = 0; id < engine.size(); ++id) {
+        added &= matches_model(engine.prices(id), engine.parameters(id));
+    }
+    std::cout << "add_position: " << engine.size() << " priced" << (added ? ", ok" : ", FAILED") << '\n';
+    passed &= added;
+
+    Snapshot before = snapshot(engine);
+    const auto spot_repriced = engine.update_spot("AAA", 103.5);
+    passed &= check_update("update_spot AAA", engine, before, spot_repriced, {a_usd_1, a_usd_2, a_eur});
+    passed &= engine.parameters(a_eur).underlying_price == 103.5;
+
+    before = snapshot(engine);
+    const auto rate_repriced = engine.update_rate("USD", 0.055);
+    passed &= check_update("update_rate USD", engine, before, rate_repriced, {a_usd_1, a_usd_2, b_usd});
+    passed &= engine.parameters(b_usd).risk_free_rate == 0.055;
+
+    // The new rate must reach the spot path's cached terms too
+    before = snapshot(engine);
+    const auto spot_after_rate = engine.update_spot("BBB", 48.0);
+    passed &= check_update("update_spot BBB", engine, before, spot_after_rate, {b_usd, b_eur});
+
+    before = snapshot(engine);
+    engine.update_volatility(a_eur, 0.45);
+    const std::vector<PositionId> one{a_eur};
+    passed &= check_update("update_volatility", engine, before, one, one);
+    passed &= engine.parameters(a_eur).volatility == 0.45;
+
+    before = snapshot(engine);
+    const auto unknown = engine.update_spot("CCC", 10.0);
+    passed &= check_update("update_spot unknown", engine, before, unknown, {});
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
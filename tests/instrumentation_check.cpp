@@ -0,0 +1,216 @@
+/**
+ * @file instrumentation_check.cpp
+ * @brief Latency histogram buckets, quantiles, merging and Prometheus export
+ *
+ * Bucket edges must round-trip through bucket_index at every boundary, fall
+ * on powers of two and bound the relative error at 6.25% up to the
+ * max_exponent overflow bucket. Quantiles of 1..1000 ns must land on the
+ * hand-computed bucket edges. Calls recorded by several threads, all joined
+ * before snapshot(), must be summed exactly alongside the calling thread's
+ * own, and the Prometheus text must hold cumulative buckets that never
+ * decrease, a +Inf bucket equal to _count and the same quantiles.
+ */
+
+#include "Instrumentation.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace BlackScholes::Instrumentation;
+using Histogram = LatencyHistogram;
+
+bool check_bucket_edges() {
+    bool ok = true;
+    // Every bucket ends where the next begins
+    for (std::size_t i = 0; i + 1 < Histogram::bucket_count; ++i) {
+        const std::uint64_t upper = Histogram::bucket_upper_bound(i);
+        if (Histogram::bucket_index(upper - 1) != i || Histogram::bucket_index(upper) != i + 1) {
+            std::cout << "  bucket " << i << " upper bound " << upper << " does not round-trip\n";
+            ok = false;
+        }
+    }
+    // Powers of two open a bucket, and everything from 2^max_exponent shares the last one
+    for (int k = Histogram::sub_bucket_bits; k < Histogram::max_exponent; ++k) {
+        const std::uint64_t edge = std::uint64_t{1} << k;
+        const std::size_t index = Histogram::bucket_index(edge);
+        ok &= index == static_cast<std::size_t>(k - Histogram::sub_bucket_bits + 1) * Histogram::sub_buckets;
+        ok &= Histogram::bucket_upper_bound(index - 1) == edge;
+    }
+    const std::uint64_t overflow = std::uint64_t{1} << Histogram::max_exponent;
+    const std::size_t last = Histogram::bucket_count - 1;
+    ok &= Histogram::bucket_upper_bound(last) == overflow;
+    ok &= Histogram::bucket_index(overflow - 1) == last && Histogram::bucket_index(overflow) == last
+       && Histogram::bucket_index(UINT64_MAX) == last;
+    std::cout << Histogram::bucket_count << " bucket edges round-trip: " << (ok ? "ok" : "FAILED") << '\n';
+    return ok;
+}
+
+bool check_relative_error() {
+    bool ok = true;
+    double worst = 0.0;
+    auto check_value = [&](std::uint64_t v) {
+        const std::uint64_t upper = Histogram::bucket_upper_bound(Histogram::bucket_index(v));
+        // Exact below sub_buckets: the bucket holds v alone
+        const bool exact = v >= Histogram::sub_buckets || upper == v + 1;
+        const double error = static_cast<double>(upper - v) / static_cast<double>(v);
+        if (v >= Histogram::sub_buckets) {
+            worst = std::max(worst, error);
+        }
+        if (!(upper > v) || !exact || (v >= Histogram::sub_buckets && error > 0.0625)) {
+            std::cout << "  " << v << " ns in a bucket ending at " << upper << '\n';
+            ok = false;
+        }
+    };
+    for (std::uint64_t v = 1; v < 4096; ++v) {
+        check_value(v);
+    }
+    std::mt19937_64 rng(41);
+    std::uniform_real_distribution<double> log2_ns(0.0, Histogram::max_exponent);
+    for (int i = 0; i < 100000; ++i) {
+        check_value(std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::exp2(log2_ns(rng)))));
+    }
+    for (int k = Histogram::sub_bucket_bits; k < Histogram::max_exponent; ++k) {
+        check_value(std::uint64_t{1} << k);
+        check_value((std::uint64_t{2} << k) - 1);
+    }
+    std::cout << "relative error: worst " << worst << (ok ? ", ok" : ", FAILED") << '\n';
+    return ok;
+}
+
+/**
+ * @brief Quantiles and counts of 1..1000 ns recorded `copies` times each, from the hand-computed edges
+ *
+ * Rank 500 is 500 ns in [496, 512); rank 900 is 900 ns in [896, 928); rank
+ * 990 is 990 ns in [960, 992); rank 999 is 999 ns in [992, 1024), clamped to
+ * the 1000 ns maximum.
+ */
+bool matches_uniform(const Histogram& h, std::uint64_t copies) {
+    bool ok = h.count() == 1000 * copies && h.total_ns() == 500500 * copies
+           && h.min_ns() == 1 && h.max_ns() == 1000;
+    ok &= h.value_at_quantile(0.0) == 2 && h.value_at_quantile(0.5) == 512 && h.value_at_quantile(0.9) == 928
+       && h.value_at_quantile(0.99) == 992 && h.value_at_quantile(0.999) == 1000 && h.value_at_quantile(1.0) == 1000;
+    ok &= h.count_below(16) == 15 * copies && h.count_below(64) == 63 * copies && h.count_below(512) == 511 * copies
+       && h.count_below(std::uint64_t{1} << 20) == 1000 * copies;
+    return ok;
+}
+
+/**
+ * @brief Value of the first exposition line starting with `prefix`, or NaN
+ */
+double metric_value(const std::string& text, const std::string& prefix) {
+    std::istringstream lines(text);
+    for (std::string line; std::getline(lines, line);) {
+        if (line.starts_with(prefix)) {
+            return std::stod(line.substr(line.rfind(' ') + 1));
+        }
+    }
+    return NAN;
+}
+
+bool check_prometheus(const Snapshot& snapshot, Probe probe) {
+    std::ostringstream out;
+    write_prometheus(out, snapshot);
+    const std::string text = out.str();
+    const std::string label = "{probe=\"" + std::string(probe_name(probe)) + '"';
+    const LatencyHistogram& h = snapshot[probe];
+
+    // Cumulative buckets in order of their le edges
+    std::istringstream lines(text);
+    std::vector<std::pair<double, double>> buckets;
+    const std::string bucket_prefix = "blackscholes_latency_seconds_bucket" + label + ",le=\"";
+    for (std::string line; std::getline(lines, line);) {
+        if (line.starts_with(bucket_prefix)) {
+            const std::string le = line.substr(bucket_prefix.size(), line.find('"', bucket_prefix.size()) - bucket_prefix.size());
+            buckets.emplace_back(le == "+Inf" ? INFINITY : std::stod(le), std::stod(line.substr(line.rfind(' ') + 1)));
+        }
+    }
+    bool ok = buckets.size() > 2 && buckets.back().first == INFINITY;
+    for (std::size_t i = 1; ok && i < buckets.size(); ++i) {
+        ok = buckets[i].first > buckets[i - 1].first && buckets[i].second >= buckets[i - 1].second;
+    }
+    const double count = metric_value(text, "blackscholes_latency_seconds_count" + label);
+    ok &= !buckets.empty() && buckets.back().second == count && count == static_cast<double>(h.count());
+    ok &= metric_value(text, bucket_prefix + "6.4e-08\"") == static_cast<double>(h.count_below(64));
+    ok &= metric_value(text, "blackscholes_items_total" + label) == static_cast<double>(h.items());
+    ok &= std::abs(metric_value(text, "blackscholes_latency_seconds_sum" + label) - static_cast<double>(h.total_ns()) * 1e-9)
+          <= 1e-8 * static_cast<double>(h.total_ns()) * 1e-9;
+
+    // Quantile gauges are the histogram's quantiles in seconds
+    for (const auto& [q, name] : {std::pair{0.5, "0.5"}, std::pair{0.9, "0.9"}, std::pair{0.99, "0.99"},
+                                  std::pair{0.999, "0.999"}}) {
+        const double gauge = metric_value(text, "blackscholes_latency_quantile_seconds" + label + ",quantile=\"" + name + "\"}");
+        const double expected = static_cast<double>(h.value_at_quantile(q)) * 1e-9;
+        ok &= std::abs(gauge - expected) <= 1e-8 * expected;
+    }
+
+    // Probes without calls are left out
+    ok &= text.find(std::string(probe_name(Probe::GuiFrame))) == std::string::npos;
+    std::cout << "Prometheus text: " << buckets.size() << " buckets" << (ok ? ", ok" : ", FAILED") << '\n';
+    if (!ok) {
+        std::cout << text;
+    }
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool passed = true;
+
+    passed &= check_bucket_edges();
+    passed &= check_relative_error();
+
+    LatencyHistogram uniform;
+    for (std::uint64_t v = 1; v <= 1000; ++v) {
+        uniform.record(v, 2);
+    }
+    const bool empty_ok = LatencyHistogram{}.value_at_quantile(0.5) == 0;
+    const bool quantiles_ok = matches_uniform(uniform, 1) && empty_ok;
+    std::cout << "quantiles of 1..1000 ns: " << (quantiles_ok ? "ok" : "FAILED") << '\n';
+    passed &= quantiles_ok;
+
+    // Four threads that exit before the snapshot, plus the calling thread, which stays live
+    reset();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (std::uint64_t v = 1; v <= 1000; ++v) {
+                record(Probe::BatchPricing, v, 2);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (std::uint64_t v = 1; v <= 1000; ++v) {
+        record(Probe::BatchPricing, v, 2);
+    }
+    const Snapshot merged = snapshot();
+    const LatencyHistogram& batch = merged[Probe::BatchPricing];
+    bool merged_ok = matches_uniform(batch, 5) && batch.items() == 10000;
+    for (std::size_t i = 0; i < Histogram::bucket_count; ++i) {
+        const std::uint64_t edge = Histogram::bucket_upper_bound(i);
+        merged_ok &= batch.count_below(edge) == 5 * uniform.count_below(edge);
+    }
+    merged_ok &= merged[Probe::CalculatePrices].count() == 0;
+    std::cout << "snapshot of 5 threads: " << batch.count() << " calls" << (merged_ok ? ", ok" : ", FAILED") << '\n';
+    passed &= merged_ok;
+
+    passed &= check_prometheus(merged, Probe::BatchPricing);
+
+    reset();
+    const bool reset_ok = snapshot()[Probe::BatchPricing].count() == 0;
+    std::cout << "reset: " << (reset_ok ? "ok" : "FAILED") << '\n';
+    passed &= reset_ok;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file progressive_check.cpp
+ * @brief Progressive curves refine to Model::generate_price_curve
+ *
+ * A request larger than the coarse pass must return a coarse curve over the
+ * same range at once, and polling must then adopt a refined curve that
+ * reproduces generate_price_curve point for point. A second request made
+ * while the first is still refining must win: no poll may ever hand back
+ * the superseded curve.
+ */
+
+#include "BlackScholesModel.hpp"
+#include "ProgressiveCurve.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <tuple>
+
+namespace {
+
+using namespace BlackScholes;
+
+/**
+ * @brief Poll until the refinement is adopted, or give up after a generous timeout
+ */
+bool wait_for_refinement(ProgressiveCurve& curve) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (curve.poll()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+/**
+ * @brief The curve holds exactly the points of generate_price_curve
+ */
+bool matches_model(const ProgressiveCurve& curve, const OptionParameters& params, double range, int points) {
+    const auto reference = Model::generate_price_curve(params, range, points);
+    if (curve.size() != reference.size()) {
+        std::cout << "  " << curve.size() << " points vs " << reference.size() << '\n';
+        return false;
+    }
+    const auto close = [](double value, double expected) {
+        return std::abs(value - expected) <= 1e-12 * std::max(1.0, std::abs(expected));
+    };
+    for (std::size_t i = 0; i < reference.size(); ++i) {
+        const auto [S, call, put] = reference[i];
+        if (curve.underlying()[i] != S || !close(curve.call()[i], call) || !close(curve.put()[i], put)) {
+            std::cout << "  point " << i << ": S " << curve.underlying()[i] << " vs " << S
+                      << ", call " << curve.call()[i] << " vs " << call
+                      << ", put " << curve.put()[i] << " vs " << put << '\n';
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    std::cout.precision(10);
+    bool passed = true;
+
+    ProgressiveCurve curve(64);
+    const OptionParameters params(100.0, 95.0, 0.5, 0.03, 0.25, 0.01);
+
+    // Small curves are complete on return
+    curve.request(params, 40.0, 50);
+    const bool small_ok = !curve.refining() && matches_model(curve, params, 40.0, 50);
+    std::cout << "50 points, synchronous: " << (small_ok ? "ok" : "FAILED") << '\n';
+    passed &= small_ok;
+
+    // Large curves start coarse over the same range, then refine
+    const std::uint64_t before = curve.version();
+    curve.request(params, 40.0, 100000);
+    const bool coarse_ok = curve.refining() && curve.size() == 64 && curve.target_points() == 100000
+        && curve.version() != before
+        && curve.underlying().front() == 60.0 && std::abs(curve.underlying().back() - 140.0) < 1e-12;
+    std::cout << "coarse pass: " << curve.size() << " points" << (coarse_ok ? ", ok" : ", FAILED") << '\n';
+    passed &= coarse_ok;
+
+    const bool refined = wait_for_refinement(curve);
+    const bool refined_ok = refined && !curve.refining() && matches_model(curve, params, 40.0, 100000);
+    std::cout << "refined: " << curve.size() << " points" << (refined_ok ? ", ok" : ", FAILED") << '\n';
+    passed &= refined_ok;
+
+    // A new request during refinement discards the stale one, however the threads interleave
+    const OptionParameters stale(100.0, 110.0, 2.0, 0.05, 0.6, 0.0);
+    const OptionParameters fresh(80.0, 85.0, 0.25, 0.01, 0.15, 0.02);
+    bool superseded_ok = true;
+    for (int round = 0; round < 20; ++round) {
+        curve.request(stale, 60.0, 400000);
+        curve.request(fresh, 30.0, 120000 + round);
+        superseded_ok &= wait_for_refinement(curve) && matches_model(curve, fresh, 30.0, 120000 + round);
+        superseded_ok &= !curve.poll();
+    }
+    std::cout << "superseded requests discarded: " << (superseded_ok ? "ok" : "FAILED") << '\n';
+    passed &= superseded_ok;
+
+    // clear() also cancels a refinement in flight
+    curve.request(stale, 60.0, 400000);
+    curve.clear();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const bool cleared_ok = curve.empty() && !curve.poll() && curve.empty();
+    std::cout << "clear: " << (cleared_ok ? "ok" : "FAILED") << '\n';
+    passed &= cleared_ok;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file proxy_check.cpp
+ * @brief Greeks proxy estimates, sampling and fallback
+ *
+ * Moves r and q alone, with spot, volatility and expiry fixed, and compares
+ * the Taylor estimate with a full revaluation; sampling is disabled there,
+ * so the proxy itself has to price the move. A second proxy samples every
+ * third estimate: a small move must stay within the threshold and return
+ * the estimate, a large one must breach it, return the exact PnL, update
+ * the error report and re-anchor the expansion on the breaching state.
+ */
+
+#include "GreeksProxy.hpp"
+#include "TestSupport.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+
+namespace {
+
+using namespace BlackScholes;
+using Testing::check;
+using Testing::Report;
+
+/**
+ * @brief Error the proxy reports for an estimate against the full revaluation
+ */
+double sample_error(const PnLEstimate& approx, const OptionPrices& full, const OptionPrices& base) {
+    return std::max(std::abs(approx.call_pnl - (full.call_price - base.call_price)),
+                    std::abs(approx.put_pnl - (full.put_price - base.put_price)));
+}
+
+} // namespace
+
+int main() {
+    std::cout.precision(8);
+    bool passed = true;
+
+    const OptionParameters base(100.0, 105.0, 0.75, 0.03, 0.25, 0.01);
+    const OptionPrices base_prices = Model::calculate_prices(base);
+    GreeksProxy proxy(base, ProxyConfig{.sample_interval = 0});
+
+    // 25 bp moves: the second-order residual stays under 1e-3 against first-order PnL near 0.1
+    const OptionParameters rate_move(100.0, 105.0, 0.75, 0.0325, 0.25, 0.01);
+    const OptionParameters dividend_move(100.0, 105.0, 0.75, 0.03, 0.25, 0.0125);
+    const OptionParameters both_move(100.0, 105.0, 0.75, 0.0325, 0.25, 0.0125);
+    for (const auto& [name, current] : {std::pair{"rate", rate_move}, std::pair{"dividend", dividend_move},
+                                        std::pair{"rate and dividend", both_move}}) {
+        const PnLEstimate estimate = proxy.estimate(current);
+        const OptionPrices full = Model::calculate_prices(current);
+        std::cout << name << " move\n";
+        passed &= !estimate.full_revaluation;
+        passed &= check("  call", estimate.call_pnl, full.call_price - base_prices.call_price, 1e-3, Report::Always);
+        passed &= check("  put", estimate.put_pnl, full.put_price - base_prices.put_price, 1e-3, Report::Always);
+    }
+    passed &= proxy.report().estimates == 3 && proxy.report().samples == 0;
+
+    // Every third estimate is checked against a full revaluation
+    GreeksProxy sampled(base, ProxyConfig{.sample_interval = 3, .error_threshold = 0.01});
+    const OptionParameters small_move(100.5, 105.0, 0.75, 0.03, 0.25, 0.01);
+    const PnLEstimate small = sampled.estimate(small_move);
+    bool sampling_ok = sampled.estimate(small_move).call_pnl == small.call_pnl && sampled.report().samples == 0;
+    const PnLEstimate small_sampled = sampled.estimate(small_move);
+    const double small_error = sample_error(small, Model::calculate_prices(small_move), base_prices);
+    sampling_ok &= !small_sampled.full_revaluation && small_sampled.call_pnl == small.call_pnl;
+    sampling_ok &= sampled.report().estimates == 3 && sampled.report().samples == 1 && sampled.report().fallbacks == 0;
+    sampling_ok &= small_error <= 0.01 && sampled.report().last_abs_error == small_error;
+    std::cout << "small move sampled: error " << small_error << (sampling_ok ? ", ok" : ", FAILED") << '\n';
+    passed &= sampling_ok;
+
+    // A 15% spot move breaches the threshold at the next sample: the exact PnL comes back
+    const OptionParameters large_move(115.0, 105.0, 0.75, 0.03, 0.25, 0.01);
+    const OptionPrices large_prices = Model::calculate_prices(large_move);
+    const PnLEstimate large = sampled.estimate(large_move);
+    bool fallback_ok = !large.full_revaluation && sampled.estimate(large_move).call_pnl == large.call_pnl;
+    const PnLEstimate fallback = sampled.estimate(large_move);
+    const double large_error = sample_error(large, large_prices, base_prices);
+    fallback_ok &= large_error > 0.01 && fallback.full_revaluation;
+    fallback_ok &= fallback.call_pnl == large_prices.call_price - base_prices.call_price
+                && fallback.put_pnl == large_prices.put_price - base_prices.put_price;
+    const ProxyErrorReport& report = sampled.report();
+    fallback_ok &= report.estimates == 6 && report.samples == 2 && report.fallbacks == 1;
+    fallback_ok &= check("  max error", report.max_abs_error, large_error, 0.0)
+                && check("  mean error", report.mean_abs_error, 0.5 * (small_error + large_error), 1e-15)
+                && check("  last error", report.last_abs_error, large_error, 0.0);
+    std::cout << "large move fell back: error " << large_error << (fallback_ok ? ", ok" : ", FAILED") << '\n';
+    passed &= fallback_ok;
+
+    // The expansion now runs from the breaching state, offset by the PnL realised up to it
+    const OptionParameters after(115.5, 105.0, 0.75, 0.03, 0.25, 0.01);
+    const PnLEstimate next = sampled.estimate(after);
+    const OptionPrices after_prices = Model::calculate_prices(after);
+    const double dS = after.underlying_price - large_move.underlying_price;
+    const double gamma_term = 0.5 * large_prices.gamma * dS * dS;
+    bool anchored_ok = !next.full_revaluation;
+    anchored_ok &= check("  call from anchor", next.call_pnl,
+                         large_prices.call_price - base_prices.call_price + large_prices.delta_call * dS + gamma_term, 1e-12);
+    anchored_ok &= check("  put from anchor", next.put_pnl,
+                         large_prices.put_price - base_prices.put_price + large_prices.delta_put * dS + gamma_term, 1e-12);
+    const double anchored_error = sample_error(next, after_prices, base_prices);
+    anchored_ok &= anchored_error < 1e-3 && anchored_error < 0.01 * large_error;
+    std::cout << "re-anchored: error " << anchored_error << (anchored_ok ? ", ok" : ", FAILED") << '\n';
+    passed &= anchored_ok;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
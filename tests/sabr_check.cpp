@@ -0,0 +1,132 @@
+/**
+ * @file sabr_check.cpp
+ * @brief SABR limits, ATM continuity and calibration round trips
+ *
+ * With β = 1 and ν = 0 the model is Black-76 at volatility α, so both
+ * expansions must return α at every strike. Near the money the Hagan and
+ * Obloj volatilities switch to series forms and must join the K = F value
+ * continuously, where α solved from an ATM volatility reproduces it. A
+ * calibration of quotes generated by known parameters recovers α, ρ and ν,
+ * and recalibrating after a small market move warm-starts in fewer
+ * iterations than a cold fit of the same quotes.
+ */
+
+#include "SabrModel.hpp"
+#include "TestSupport.hpp"
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using namespace BlackScholes;
+using Testing::check;
+
+/**
+ * @brief Slice quoted at eleven strikes, the middle one at the forward
+ */
+SabrSlice make_slice(const SabrParameters& params, double expiry, double forward) {
+    SabrSlice slice{.expiry = expiry, .forward = forward, .strikes = {}, .volatilities = {}, .weights = {}};
+    const double width = 0.15 * std::sqrt(expiry);
+    for (int j = -5; j <= 5; ++j) {
+        slice.strikes.push_back(forward * std::exp(width * j / 5.0));
+    }
+    slice.volatilities.resize(slice.strikes.size());
+    Sabr::implied_volatility_batch(params, forward, expiry, slice.strikes, slice.volatilities);
+    return slice;
+}
+
+} // namespace
+
+int main() {
+    std::cout.precision(10);
+    bool passed = true;
+    const std::array<SabrExpansion, 2> expansions{SabrExpansion::Hagan, SabrExpansion::Obloj};
+
+    // β = 1, ν = 0: lognormal with constant volatility α
+    const SabrParameters lognormal{.alpha = 0.27, .beta = 1.0, .rho = -0.4, .nu = 0.0};
+    const std::vector<double> strikes{50.0, 80.0, 99.0, 100.0, 101.0, 125.0, 200.0};
+    std::vector<double> batch(strikes.size());
+    for (const SabrExpansion expansion : expansions) {
+        Sabr::implied_volatility_batch(lognormal, 100.0, 2.0, strikes, batch, expansion);
+        for (std::size_t i = 0; i < strikes.size(); ++i) {
+            passed &= check("beta 1, nu 0", Sabr::implied_volatility(lognormal, 100.0, strikes[i], 2.0, expansion),
+                            lognormal.alpha, 1e-14);
+            passed &= check("beta 1, nu 0 batch", batch[i], lognormal.alpha, 1e-14);
+        }
+    }
+    std::cout << "beta 1, nu 0 returns alpha: " << (passed ? "ok" : "FAILED") << '\n';
+
+    // Continuity at K → F, and α from the ATM volatility reproduces it
+    for (const SabrExpansion expansion : expansions) {
+        const char* name = expansion == SabrExpansion::Hagan ? "Hagan" : "Obloj";
+        for (const double beta : {0.0, 0.5, 1.0}) {
+            const double F = 0.035;
+            const double T = 1.5;
+            const double atm_target = 0.3;
+            const double rho = -0.3;
+            const double nu = 0.6;
+            const SabrParameters p{.alpha = Sabr::alpha_from_atm(atm_target, F, T, beta, rho, nu),
+                                   .beta = beta, .rho = rho, .nu = nu};
+            const double atm = Sabr::implied_volatility(p, F, F, T, expansion);
+            bool ok = check("alpha from ATM", atm, atm_target, 1e-13);
+
+            // Across the 1e-8 series switch the smile must move by O(slope · ΔK) only
+            for (const double bump : {1e-12, 1e-9, 1e-8, 1e-7, 1e-5}) {
+                const double up = Sabr::implied_volatility(p, F, F * (1.0 + bump), T, expansion);
+                const double down = Sabr::implied_volatility(p, F, F * (1.0 - bump), T, expansion);
+                ok &= check("near ATM", 0.5 * (up + down), atm, 1e-11 + bump);
+                ok &= check("near ATM slope", up - down, 0.0, 2.0 * bump);
+            }
+            std::cout << name << " beta " << beta << ": ATM " << atm << (ok ? ", continuous" : ", FAILED") << '\n';
+            passed &= ok;
+        }
+    }
+
+    // Calibration round trip on three expiries with β fixed at 0.5
+    const double beta = 0.5;
+    const std::vector<SabrParameters> truth{
+        {.alpha = 1.9, .beta = beta, .rho = -0.35, .nu = 0.8},
+        {.alpha = 2.0, .beta = beta, .rho = -0.25, .nu = 0.5},
+        {.alpha = 2.1, .beta = beta, .rho = -0.15, .nu = 0.3}};
+    const std::vector<double> expiries{0.25, 1.0, 3.0};
+    std::vector<SabrSlice> slices;
+    for (std::size_t i = 0; i < truth.size(); ++i) {
+        slices.push_back(make_slice(truth[i], expiries[i], 100.0));
+    }
+
+    const CalibrationConfig config{.max_iterations = 200, .tolerance = 1e-14, .num_threads = 2};
+    SabrCalibrator calibrator(beta, config);
+    const std::vector<SabrFitResult> cold = calibrator.calibrate(slices);
+    for (std::size_t i = 0; i < truth.size(); ++i) {
+        const SabrParameters& p = cold[i].params;
+        std::cout << "slice " << i << ": alpha " << p.alpha << ", rho " << p.rho << ", nu " << p.nu
+                  << ", rms " << cold[i].rms_error << ", " << cold[i].iterations << " iterations\n";
+        passed &= cold[i].converged && cold[i].rms_error <= 1e-10;
+        passed &= check("alpha", p.alpha, truth[i].alpha, 1e-7) && check("rho", p.rho, truth[i].rho, 1e-7)
+               && check("nu", p.nu, truth[i].nu, 1e-7);
+    }
+
+    // A small move in the market: the warm start needs fewer iterations than a cold fit
+    std::vector<SabrSlice> moved;
+    for (std::size_t i = 0; i < truth.size(); ++i) {
+        SabrParameters p = truth[i];
+        p.rho += 0.01;
+        p.nu *= 1.02;
+        moved.push_back(make_slice(p, expiries[i], 100.0));
+    }
+    const std::vector<SabrFitResult> warm = calibrator.calibrate(moved);
+    SabrCalibrator fresh(beta, config);
+    const std::vector<SabrFitResult>& reference = fresh.calibrate(moved);
+    for (std::size_t i = 0; i < truth.size(); ++i) {
+        std::cout << "tick slice " << i << ": warm " << warm[i].iterations << " iterations, cold "
+                  << reference[i].iterations << '\n';
+        passed &= warm[i].converged && warm[i].iterations < reference[i].iterations;
+        passed &= check("warm rho", warm[i].params.rho, truth[i].rho + 0.01, 1e-7)
+               && check("warm nu", warm[i].params.nu, truth[i].nu * 1.02, 1e-7);
+    }
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
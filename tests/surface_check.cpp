@@ -0,0 +1,107 @@
+/**
+ * @file surface_check.cpp
+ * @brief Greeks surface planes against the pricing kernel
+ *
+ * The surface re-derives every Greek from hoisted row and column terms, so
+ * sampled cells of all ten planes are compared with
+ * Kernel::price<BlackScholesMerton> at the cell's spot and σ or T, for both
+ * row axes. Row 0 must hold axis_max and the last row axis_min, and each
+ * range() must be the exact minimum and maximum of its plane.
+ */
+
+#include "GreeksSurface.hpp"
+#include "PricingKernel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+using namespace BlackScholes;
+
+/**
+ * @brief Evenly spaced value as the surface lays out its grid, exact at both ends
+ */
+double grid_value(double first, double last, std::size_t index, std::size_t count) {
+    return index + 1 == count
+        ? last
+        : first + (last - first) * static_cast<double>(index) / static_cast<double>(count - 1);
+}
+
+bool check_surface(GreeksSurface& surface, const OptionParameters& base, const SurfaceSpec& spec) {
+    surface.compute(base, spec);
+    const char* name = spec.axis == SurfaceAxis::Volatility ? "spot x volatility" : "spot x time";
+    bool ok = !surface.empty();
+
+    // Every row and column at the edges plus a stride through the interior
+    std::size_t compared = 0;
+    for (std::size_t i = 0; i < spec.rows; ++i) {
+        for (std::size_t j = 0; j < spec.columns; ++j) {
+            const bool edge = i == 0 || j == 0 || i + 1 == spec.rows || j + 1 == spec.columns;
+            if (!edge && (i * spec.columns + j) % 7 != 0) {
+                continue;
+            }
+            const double S = grid_value(spec.spot_min, spec.spot_max, j, spec.columns);
+            const double axis = grid_value(spec.axis_max, spec.axis_min, i, spec.rows);
+            const double T = spec.axis == SurfaceAxis::Time ? axis : base.time_to_expiration;
+            const double sigma = spec.axis == SurfaceAxis::Volatility ? axis : base.volatility;
+            const OptionPrices expected = Kernel::price<BlackScholesMerton>(
+                S, base.strike_price, T, base.risk_free_rate, base.dividend_yield, sigma);
+
+            for (std::size_t f = 0; f < option_field_count; ++f) {
+                const auto field = static_cast<OptionField>(f);
+                const double value = surface.plane(field)[i * spec.columns + j];
+                const double reference = option_field_value(expected, field);
+                if (std::abs(value - reference) > 1e-12 * std::max(1.0, std::abs(reference))) {
+                    std::cout << "  " << option_field_name(field) << " at row " << i << ", column " << j
+                              << ": " << value << " vs " << reference << '\n';
+                    ok = false;
+                }
+            }
+            ++compared;
+        }
+    }
+
+    for (std::size_t f = 0; f < option_field_count; ++f) {
+        const auto field = static_cast<OptionField>(f);
+        const auto plane = surface.plane(field);
+        const auto [low, high] = std::minmax_element(plane.begin(), plane.end());
+        const SurfaceRange range = surface.range(field);
+        if (plane.size() != spec.rows * spec.columns || range.min != *low || range.max != *high) {
+            std::cout << "  " << option_field_name(field) << " range [" << range.min << ", " << range.max
+                      << "] vs [" << *low << ", " << *high << "]\n";
+            ok = false;
+        }
+    }
+
+    std::cout << name << ": " << compared << " cells" << (ok ? ", ok" : ", FAILED") << '\n';
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    std::cout.precision(10);
+    bool passed = true;
+
+    GreeksSurface surface(2);
+    const OptionParameters base(100.0, 105.0, 0.75, 0.04, 0.3, 0.015);
+    passed &= check_surface(surface, base, SurfaceSpec{
+        .axis = SurfaceAxis::Volatility, .spot_min = 40.0, .spot_max = 180.0,
+        .axis_min = 0.05, .axis_max = 1.2, .columns = 61, .rows = 37});
+    passed &= check_surface(surface, base, SurfaceSpec{
+        .axis = SurfaceAxis::Time, .spot_min = 60.0, .spot_max = 150.0,
+        .axis_min = 0.01, .axis_max = 5.0, .columns = 48, .rows = 53});
+
+    // Row 0 is the top of the image: the largest σ, and it differs from the last row
+    const double top = Kernel::price<BlackScholesMerton>(100.0, 105.0, 0.75, 0.04, 0.015, 1.2).vega;
+    surface.compute(base, SurfaceSpec{.axis = SurfaceAxis::Volatility, .spot_min = 100.0, .spot_max = 110.0,
+                                      .axis_min = 0.1, .axis_max = 1.2, .columns = 2, .rows = 2});
+    const auto vega = surface.plane(OptionField::Vega);
+    const bool top_first = std::abs(vega[0] - top) <= 1e-12 * top && std::abs(vega[2] - top) > 1e-3 * top;
+    std::cout << "row 0 at axis_max: " << (top_first ? "ok" : "FAILED") << '\n';
+    passed &= top_first;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
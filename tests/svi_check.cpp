@@ -0,0 +1,169 @@
+/**
+ * @file svi_check.cpp
+ * @brief SVI/SSVI calibration recovers its parameters without arbitrage
+ *
+ * Raw SVI and SSVI fits must recover the parameters of synthetic quotes
+ * exactly, cold and warm-started, and a solver that stalls must not report
+ * convergence. Durrleman's g(k) is evaluated on SSVI slices at the edge of
+ * the parameter constraints over a wide range of θ, and on a surface fitted
+ * to quotes from the plain power law ηθ^(-γ), which itself breaks the
+ * condition at long expiries.
+ */
+
+#include "SviCalibration.hpp"
+#include "TestSupport.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using namespace BlackScholes;
+using Testing::check;
+
+/**
+ * @brief Durrleman's g(k); the slice has no butterfly arbitrage where g ≥ 0
+ */
+double durrleman(const SsviParameters& surface, double k, double theta) {
+    const double phi = surface.curvature(theta);
+    const double rho = surface.rho;
+    const double z = phi * k + rho;
+    const double R = std::sqrt(z * z + 1.0 - rho * rho);
+    const double w = surface.total_variance(k, theta);
+    const double dw = 0.5 * theta * phi * (rho + z / R);
+    const double d2w = 0.5 * theta * phi * phi * (1.0 - rho * rho) / (R * R * R);
+    const double skew = 1.0 - k * dw / (2.0 * w);
+    return skew * skew - 0.25 * dw * dw * (1.0 / w + 0.25) + 0.5 * d2w;
+}
+
+/**
+ * @brief Slice quoted at eleven strikes from a total-variance function
+ */
+template <class TotalVariance>
+SviSlice make_slice(double expiry, double forward, double k_step, const TotalVariance& total_variance) {
+    SviSlice slice{.expiry = expiry, .forward = forward, .strikes = {}, .volatilities = {}, .weights = {}};
+    for (int j = -5; j <= 5; ++j) {
+        const double k = k_step * j;
+        slice.strikes.push_back(forward * std::exp(k));
+        slice.volatilities.push_back(std::sqrt(total_variance(k) / expiry));
+    }
+    return slice;
+}
+
+/**
+ * @brief Smallest g(k) over k in [-6, 6]
+ */
+double min_durrleman(const SsviParameters& surface, double theta) {
+    double lowest = INFINITY;
+    for (int i = -600; i <= 600; ++i) {
+        lowest = std::min(lowest, durrleman(surface, i / 100.0, theta));
+    }
+    return lowest;
+}
+
+} // namespace
+
+int main() {
+    std::cout.precision(10);
+    bool passed = true;
+
+    // Raw SVI: recover the parameters of each slice, cold and then warm-started
+    const std::vector<SviParameters> truth{
+        {.a = 0.01, .b = 0.05, .rho = -0.4, .m = 0.02, .sigma = 0.15},
+        {.a = 0.03, .b = 0.08, .rho = -0.3, .m = 0.05, .sigma = 0.25},
+        {.a = 0.06, .b = 0.10, .rho = -0.2, .m = 0.08, .sigma = 0.35}};
+    const std::vector<double> expiries{0.5, 1.0, 2.0};
+    std::vector<SviSlice> svi_slices;
+    for (std::size_t i = 0; i < truth.size(); ++i) {
+        svi_slices.push_back(make_slice(expiries[i], 100.0, 0.1, [&](double k) { return truth[i].total_variance(k); }));
+    }
+    SviCalibrator svi(CalibrationConfig{.max_iterations = 500, .tolerance = 1e-14, .num_threads = 2});
+    for (const char* run : {"cold", "warm"}) {
+        const std::vector<SviFitResult>& results = svi.calibrate(svi_slices);
+        for (std::size_t i = 0; i < truth.size(); ++i) {
+            const SviParameters& p = results[i].params;
+            std::cout << "SVI " << run << " slice " << i << ": rms " << results[i].rms_error << ", "
+                      << results[i].iterations << " iterations\n";
+            passed &= results[i].converged && results[i].rms_error <= 1e-12;
+            passed &= check("a", p.a, truth[i].a, 1e-8) && check("b", p.b, truth[i].b, 1e-8)
+                   && check("rho", p.rho, truth[i].rho, 1e-8) && check("m", p.m, truth[i].m, 1e-8)
+                   && check("sigma", p.sigma, truth[i].sigma, 1e-8);
+        }
+    }
+
+    // SSVI: recover ρ, η, γ and the ATM variances
+    const SsviParameters ssvi_truth{.rho = -0.35, .eta = 1.2, .gamma = 0.4, .expiries = {}, .forwards = {}, .theta = {}};
+    std::vector<SviSlice> ssvi_slices;
+    for (const double expiry : {0.25, 0.5, 1.0, 2.0}) {
+        const double theta = 0.04 * expiry;
+        ssvi_slices.push_back(make_slice(expiry, 100.0, 0.3 * std::sqrt(theta),
+                                         [&](double k) { return ssvi_truth.total_variance(k, theta); }));
+    }
+    SviCalibrator ssvi(CalibrationConfig{.max_iterations = 500, .tolerance = 1e-14, .num_threads = 2});
+    const SsviParameters& recovered = ssvi.calibrate_ssvi(ssvi_slices);
+    std::cout << "SSVI: rho " << recovered.rho << ", eta " << recovered.eta << ", gamma " << recovered.gamma << '\n';
+    passed &= check("rho", recovered.rho, ssvi_truth.rho, 1e-6) && check("eta", recovered.eta, ssvi_truth.eta, 1e-6)
+           && check("gamma", recovered.gamma, ssvi_truth.gamma, 1e-6);
+    for (std::size_t i = 0; i < ssvi_slices.size(); ++i) {
+        passed &= check("theta", recovered.theta[i], 0.04 * ssvi_slices[i].expiry, 1e-10);
+    }
+
+    // A minimum pinned by the constraints leaves cost that no step can reduce: not converged
+    const std::vector<double> zeros(4, 0.0);
+    const auto stalled = Detail::levenberg_marquardt<1>(
+        {2.0}, zeros, {}, [](const std::array<double, 1>& p, std::size_t, std::array<double, 1>& grad) {
+            grad[0] = 1.0;
+            return p[0];
+        },
+        [](std::array<double, 1>& p) { p[0] = std::max(p[0], 1.0); }, CalibrationConfig{});
+    std::cout << "pinned minimum: x " << stalled.params[0] << ", cost " << stalled.cost << ", converged "
+              << stalled.converged << '\n';
+    passed &= !stalled.converged && stalled.params[0] == 1.0;
+
+    // Edge of the constraints: η(1 + |ρ|) = 2, over θ from 0.01 to 50
+    double edge_min = INFINITY;
+    for (const double rho : {-0.9, -0.3, 0.0, 0.5}) {
+        for (const double gamma : {0.1, 0.3, 0.5}) {
+            const SsviParameters surface{.rho = rho, .eta = 2.0 / (1.0 + std::abs(rho)), .gamma = gamma,
+                                         .expiries = {}, .forwards = {}, .theta = {}};
+            for (double theta = 0.01; theta <= 50.0; theta *= 1.25) {
+                edge_min = std::min(edge_min, min_durrleman(surface, theta));
+            }
+        }
+    }
+    std::cout << "constraint edge: min g(k) " << edge_min << '\n';
+    passed &= edge_min >= 0.0;
+
+    // Quotes from ηθ^(-γ) at its own bound, 45% volatility out to 20 years (θ up to 4)
+    const double rho = -0.3;
+    const double eta = 2.0 / (1.0 + std::abs(rho));
+    const double gamma = 0.3;
+    std::vector<SviSlice> slices;
+    for (const double expiry : {0.25, 1.0, 2.0, 5.0, 10.0, 20.0}) {
+        const double theta = 0.45 * 0.45 * expiry;
+        const double phi = eta * std::pow(theta, -gamma);
+        SviSlice slice{.expiry = expiry, .forward = 100.0, .strikes = {}, .volatilities = {}, .weights = {}};
+        for (int j = -5; j <= 5; ++j) {
+            const double k = 0.3 * j * std::sqrt(theta);
+            const double z = phi * k + rho;
+            const double w = 0.5 * theta * (1.0 + rho * phi * k + std::sqrt(z * z + 1.0 - rho * rho));
+            slice.strikes.push_back(100.0 * std::exp(k));
+            slice.volatilities.push_back(std::sqrt(w / expiry));
+        }
+        slices.push_back(std::move(slice));
+    }
+
+    SviCalibrator calibrator(CalibrationConfig{.max_iterations = 200, .tolerance = 1e-12, .num_threads = 2});
+    const SsviParameters& fitted = calibrator.calibrate_ssvi(slices);
+    std::cout << "fitted: rho " << fitted.rho << ", eta " << fitted.eta << ", gamma " << fitted.gamma << '\n';
+    for (std::size_t i = 0; i < fitted.theta.size(); ++i) {
+        const double lowest = min_durrleman(fitted, fitted.theta[i]);
+        std::cout << "  theta " << fitted.theta[i] << ": min g(k) " << lowest << '\n';
+        passed &= lowest >= 0.0 && (i == 0 || fitted.theta[i] >= fitted.theta[i - 1]);
+    }
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
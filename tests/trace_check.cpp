@@ -0,0 +1,66 @@
+/**
+ * @file trace_check.cpp
+ * @brief Trace buffers of exited threads are reused without losing their spans
+ *
+ * Starts many short-lived traced workers, as a batched VaR run does, and
+ * checks that every span reaches the trace while the number of tracks
+ * stays at the number of threads alive at once.
+ */
+
+#include "TraceEvents.hpp"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Tracing = BlackScholes::Tracing;
+
+int main() {
+    constexpr int batch_count = 500;
+    constexpr int workers_per_batch = 4;
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "blackscholes_trace_check.json";
+
+    Tracing::set_enabled(true);
+    Tracing::set_thread_name("main");
+    for (int batch = 0; batch < batch_count; ++batch) {
+        std::vector<std::jthread> workers;
+        for (int w = 0; w < workers_per_batch; ++w) {
+            workers.emplace_back([] {
+                Tracing::set_thread_name("worker");
+                const Tracing::TraceSpan span("trace_check::worker", "test");
+            });
+        }
+    }
+    Tracing::set_enabled(false);
+    Tracing::write_chrome_trace(path.string());
+
+    // One event per line: count worker spans and distinct tracks
+    std::ifstream in(path);
+    std::set<std::string> tracks;
+    int spans = 0;
+    for (std::string line; std::getline(in, line);) {
+        const auto tid = line.find("\"tid\":");
+        if (tid == std::string::npos) {
+            continue;
+        }
+        tracks.insert(line.substr(tid, line.find(',', tid) - tid));
+        if (line.find("trace_check::worker") != std::string::npos) {
+            ++spans;
+        }
+    }
+    in.close();
+    std::filesystem::remove(path);
+
+    // The process metadata event uses tid 0; then main plus the live workers
+    const std::size_t max_tracks = 2 + workers_per_batch;
+    std::cout << spans << " worker spans on " << tracks.size() << " tracks, "
+              << Tracing::dropped_spans() << " dropped\n";
+    const bool passed = spans == batch_count * workers_per_batch && tracks.size() <= max_tracks
+        && Tracing::dropped_spans() == 0;
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
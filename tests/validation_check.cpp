@@ -0,0 +1,155 @@
+/**
+ * @file validation_check.cpp
+ * @brief Bulk validation reason codes, packed mask and masking
+ *
+ * Every column of an otherwise valid row is set in turn to zero, a negative
+ * value, NaN, +∞ and -∞, alongside valid rows and rows failing several
+ * rules, in a batch whose length is not a multiple of 64. Each row's reason
+ * code must match the rules independently, and its validity must agree with
+ * OptionParameters::is_valid. The packed mask, including the unused bits of
+ * the partial last word, the valid count and mask_invalid are checked too.
+ */
+
+#include "BatchValidation.hpp"
+#include "BlackScholesModel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using namespace BlackScholes;
+
+struct Rows {
+    std::vector<double> S, K, T, r, q, sigma;
+
+    void add(double s, double k, double t, double rate, double yield, double vol) {
+        S.push_back(s);
+        K.push_back(k);
+        T.push_back(t);
+        r.push_back(rate);
+        q.push_back(yield);
+        sigma.push_back(vol);
+    }
+
+    [[nodiscard]] OptionBatch batch() const {
+        return OptionBatch{S, K, T, r, q, sigma};
+    }
+};
+
+std::uint8_t flag(ValidationReason reason) {
+    return static_cast<std::uint8_t>(reason);
+}
+
+/**
+ * @brief Reason code of one row, from the documented rules
+ */
+std::uint8_t expected_reasons(double S, double K, double T, double r, double q, double sigma) {
+    std::uint8_t code = 0;
+    code |= S > 0.0 ? 0 : flag(ValidationReason::NonPositiveUnderlying);
+    code |= K > 0.0 ? 0 : flag(ValidationReason::NonPositiveStrike);
+    code |= T > 0.0 ? 0 : flag(ValidationReason::NonPositiveExpiry);
+    code |= sigma > 0.0 ? 0 : flag(ValidationReason::NonPositiveVolatility);
+    code |= std::isfinite(r) ? 0 : flag(ValidationReason::NonFiniteRate);
+    code |= std::isfinite(q) ? 0 : flag(ValidationReason::NonFiniteYield);
+    const bool finite = std::isfinite(S) && std::isfinite(K) && std::isfinite(T) && std::isfinite(sigma);
+    code |= finite ? 0 : flag(ValidationReason::NonFiniteInput);
+    return code;
+}
+
+} // namespace
+
+int main() {
+    bool passed = true;
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    const std::vector<double> bad_values{0.0, -1.0, nan, inf, -inf};
+
+    // One failing column per row, for every column and every bad value
+    Rows rows;
+    const std::vector<double> valid{100.0, 95.0, 0.5, 0.03, 0.01, 0.2};
+    for (std::size_t column = 0; column < valid.size(); ++column) {
+        for (const double value : bad_values) {
+            std::vector<double> row = valid;
+            row[column] = value;
+            rows.add(row[0], row[1], row[2], row[3], row[4], row[5]);
+        }
+    }
+    // Several rules at once, and zero or negative r and q, which are valid
+    rows.add(-5.0, nan, 0.0, inf, -inf, -0.1);
+    rows.add(nan, nan, nan, nan, nan, nan);
+    rows.add(100.0, 95.0, 0.5, 0.0, 0.0, 0.2);
+    rows.add(100.0, 95.0, 0.5, -0.02, -0.01, 0.2);
+    // Pad with valid rows to 150: three mask words, the last one partial
+    for (std::size_t i = 0; rows.S.size() < 150; ++i) {
+        rows.add(50.0 + static_cast<double>(i), 100.0, 1.0, 0.02, 0.0, 0.3);
+    }
+    const OptionBatch batch = rows.batch();
+    const std::size_t n = batch.size();
+
+    const ValidationReport report = validate_batch(batch);
+    std::size_t expected_valid = 0;
+    bool rows_ok = report.reasons.size() == n && report.valid_mask.size() == mask_words(n);
+    for (std::size_t i = 0; rows_ok && i < n; ++i) {
+        const std::uint8_t expected = expected_reasons(rows.S[i], rows.K[i], rows.T[i], rows.r[i], rows.q[i], rows.sigma[i]);
+        const bool valid = OptionParameters::trusted(rows.S[i], rows.K[i], rows.T[i], rows.r[i], rows.sigma[i], rows.q[i]).is_valid();
+        expected_valid += valid ? 1 : 0;
+        if (report.reasons[i] != expected || (expected == 0) != valid || report.is_valid(i) != valid) {
+            std::cout << "  row " << i << ": reasons " << int(report.reasons[i]) << " vs " << int(expected)
+                      << ", is_valid " << valid << ", mask " << report.is_valid(i) << '\n';
+            rows_ok = false;
+        }
+    }
+    const bool tail_clear = (report.valid_mask.back() >> (n % 64)) == 0;
+    const bool count_ok = report.valid_count == expected_valid && !report.all_valid();
+    std::cout << n << " rows, " << report.valid_count << " valid: reasons " << (rows_ok ? "ok" : "FAILED")
+              << ", count " << (count_ok ? "ok" : "FAILED") << ", partial word " << (tail_clear ? "ok" : "FAILED") << '\n';
+    passed &= rows_ok && count_ok && tail_clear;
+
+    // The caller-buffer overload overwrites every word, stale bits included
+    std::vector<std::uint64_t> mask(mask_words(n), ~std::uint64_t{0});
+    std::vector<std::uint8_t> reasons(n, 0xff);
+    const std::size_t count = validate_batch(batch, mask, reasons);
+    const bool buffers_ok = count == report.valid_count
+        && std::equal(mask.begin(), mask.end(), report.valid_mask.begin())
+        && std::equal(reasons.begin(), reasons.end(), report.reasons.begin());
+    std::cout << "caller buffers: " << (buffers_ok ? "ok" : "FAILED") << '\n';
+    passed &= buffers_ok;
+
+    // mask_invalid blanks exactly the rejected rows
+    std::vector<double> values(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        values[i] = static_cast<double>(i);
+    }
+    mask_invalid(report.valid_mask, values);
+    bool masked_ok = true;
+    for (std::size_t i = 0; i < n; ++i) {
+        masked_ok &= report.reasons[i] == 0 ? values[i] == static_cast<double>(i) : std::isnan(values[i]);
+    }
+    std::cout << "mask_invalid: " << (masked_ok ? "ok" : "FAILED") << '\n';
+    passed &= masked_ok;
+
+    // Short buffers are rejected rather than overrun
+    bool rejected = false;
+    try {
+        std::vector<double> longer(n + 64);
+        mask_invalid(report.valid_mask, longer);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    try {
+        std::vector<std::uint64_t> short_mask(mask_words(n) - 1);
+        (void)validate_batch(batch, short_mask, reasons);
+        rejected = false;
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "short buffers rejected: " << (rejected ? "ok" : "FAILED") << '\n';
+    passed &= rejected;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file var_check.cpp
+ * @brief Bounded-memory VaR matches VaR over every retained scenario
+ *
+ * The same scenarios are run from a seekable stream, which keeps only the
+ * loss tail, and from a forward-only stream, which keeps every PnL value;
+ * both must give the same VaR and ES, and the bounded run must allocate
+ * far less than one value per scenario.
+ */
+
+#include "MemoryArena.hpp"
+#include "VaREngine.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <istream>
+#include <random>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+namespace {
+
+/**
+ * @brief Stream buffer over a string that cannot seek, like a pipe
+ */
+class ForwardOnlyBuffer : public std::streambuf {
+public:
+    explicit ForwardOnlyBuffer(std::string& text) {
+        setg(text.data(), text.data(), text.data() + text.size());
+    }
+};
+
+std::string make_scenarios(std::size_t count) {
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> spot(0.0, 0.02);
+    std::normal_distribution<double> shift(0.0, 0.002);
+    std::ostringstream out;
+    out << "# rate shift, vol shift, spot returns\n";
+    for (std::size_t i = 0; i < count; ++i) {
+        out << shift(rng) << ',' << shift(rng) << ',' << spot(rng) << ',' << spot(rng) << '\n';
+    }
+    return out.str();
+}
+
+} // namespace
+
+int main() {
+    using namespace BlackScholes;
+    constexpr std::size_t scenario_count = 20000;
+
+    const std::vector<Position> book{
+        {0, OptionType::Call, 10.0, OptionParameters(100.0, 105.0, 0.5, 0.03, 0.25)},
+        {0, OptionType::Put, -4.0, OptionParameters(100.0, 90.0, 0.25, 0.03, 0.3)},
+        {1, OptionType::Put, 7.0, OptionParameters(50.0, 48.0, 1.0, 0.03, 0.2)}
+    };
+    const VaREngine engine(book, VaRConfig{.confidence = 0.99, .horizon_days = 1.0, .batch_size = 256, .num_threads = 4});
+    std::string text = make_scenarios(scenario_count);
+
+    CountingResource bounded_heap;
+    std::istringstream seekable(text);
+    const VaRResult bounded = engine.run(seekable, &bounded_heap);
+
+    CountingResource full_heap;
+    ForwardOnlyBuffer buffer(text);
+    std::istream forward_only(&buffer);
+    const VaRResult full = engine.run(forward_only, &full_heap);
+
+    std::cout << "bounded: VaR " << bounded.value_at_risk << ", ES " << bounded.expected_shortfall
+              << ", " << bounded_heap.bytes_allocated() << " bytes\n"
+              << "full:    VaR " << full.value_at_risk << ", ES " << full.expected_shortfall
+              << ", " << full_heap.bytes_allocated() << " bytes\n";
+
+    const bool same = bounded.scenarios == scenario_count && full.scenarios == scenario_count
+        && bounded.value_at_risk == full.value_at_risk
+        && std::abs(bounded.expected_shortfall - full.expected_shortfall) <= 1e-12 * std::abs(full.expected_shortfall)
+        && bounded.value_at_risk > 0.0;
+    const bool bounded_memory = bounded_heap.bytes_allocated() < scenario_count * sizeof(double) / 2;
+    return same && bounded_memory ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file vol_surface_check.cpp
+ * @brief Volatility surface interpolation, extrapolation and batch lookups
+ *
+ * A 3 × 2 grid is interpolated linearly and with a natural cubic spline in
+ * total variance. Both must reproduce the grid nodes, match hand-computed
+ * values between them and extrapolate flat in volatility past every strike
+ * and expiry edge. lookup_batch must agree with volatility() point by point
+ * for sorted and unsorted strikes within each expiry group.
+ */
+
+#include "TestSupport.hpp"
+#include "VolSurface.hpp"
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using namespace BlackScholes;
+using Testing::check;
+
+constexpr std::array<double, 3> grid_strikes{80.0, 100.0, 120.0};
+constexpr std::array<double, 2> grid_expiries{0.5, 1.0};
+constexpr std::array<double, 6> grid_vols{0.25, 0.22, 0.21, 0.23, 0.21, 0.20};
+
+VolSurface make_surface(VolInterpolation method) {
+    return VolSurface({grid_strikes.begin(), grid_strikes.end()}, {grid_expiries.begin(), grid_expiries.end()},
+                      grid_vols, method);
+}
+
+/**
+ * @brief Total variance of the natural spline through three equally spaced nodes, at a segment midpoint
+ *
+ * The inner second derivative is M = 3(y₀ - 2y₁ + y₂) / 2h², and at the
+ * midpoint of either segment the cubic term adds -Mh²/16 to the chord.
+ */
+double spline_midpoint(const std::array<double, 3>& w, std::size_t segment) {
+    const double h = grid_strikes[1] - grid_strikes[0];
+    const double M = 1.5 * (w[0] - 2.0 * w[1] + w[2]) / (h * h);
+    return 0.5 * (w[segment] + w[segment + 1]) - 0.0625 * M * h * h;
+}
+
+/**
+ * @brief Grid total variances of one expiry row
+ */
+std::array<double, 3> row_variance(std::size_t row) {
+    const double T = grid_expiries[row];
+    std::array<double, 3> w{};
+    for (std::size_t j = 0; j < w.size(); ++j) {
+        const double sigma = grid_vols[row * w.size() + j];
+        w[j] = sigma * sigma * T;
+    }
+    return w;
+}
+
+bool check_nodes(const VolSurface& surface, const char* name) {
+    bool ok = true;
+    for (std::size_t i = 0; i < grid_expiries.size(); ++i) {
+        for (std::size_t j = 0; j < grid_strikes.size(); ++j) {
+            ok &= check("  node", surface.volatility(grid_strikes[j], grid_expiries[i]),
+                        grid_vols[i * grid_strikes.size() + j], 1e-15);
+        }
+    }
+    std::cout << name << " nodes: " << (ok ? "ok" : "FAILED") << '\n';
+    return ok;
+}
+
+bool check_flat_extrapolation(const VolSurface& surface, const char* name) {
+    bool ok = true;
+    // Past the strike edges, on and between the slices
+    for (const double T : {0.5, 0.75, 1.0}) {
+        ok &= check("  below strikes", surface.volatility(50.0, T), surface.volatility(80.0, T), 1e-15);
+        ok &= check("  above strikes", surface.volatility(200.0, T), surface.volatility(120.0, T), 1e-15);
+    }
+    // Past the expiry edges, at and between the strikes
+    for (const double K : {80.0, 90.0, 100.0, 113.0, 120.0}) {
+        ok &= check("  before expiries", surface.volatility(K, 0.1), surface.volatility(K, 0.5), 1e-15);
+        ok &= check("  after expiries", surface.volatility(K, 3.0), surface.volatility(K, 1.0), 1e-15);
+    }
+    // Both at once lands on the corner nodes
+    ok &= check("  corner", surface.volatility(50.0, 0.1), grid_vols[0], 1e-15);
+    ok &= check("  corner", surface.volatility(200.0, 3.0), grid_vols[5], 1e-15);
+    std::cout << name << " flat extrapolation: " << (ok ? "ok" : "FAILED") << '\n';
+    return ok;
+}
+
+bool check_batch(const VolSurface& surface, const char* name) {
+    std::vector<double> strikes;
+    std::vector<double> expiries;
+    // Sorted strikes through and past the grid, between the slices
+    for (int k = 60; k <= 140; k += 5) {
+        strikes.push_back(k);
+        expiries.push_back(0.75);
+    }
+    // Unsorted strikes, before, on and after the expiry range
+    for (const double T : {0.2, 1.0, 2.5}) {
+        for (const double K : {115.0, 85.0, 101.0, 70.0, 99.0, 130.0, 80.0, 100.5}) {
+            strikes.push_back(K);
+            expiries.push_back(T);
+        }
+    }
+
+    std::vector<double> out(strikes.size());
+    surface.lookup_batch(strikes, expiries, out);
+    bool ok = true;
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        ok &= check("  lookup_batch", out[i], surface.volatility(strikes[i], expiries[i]), 1e-14);
+    }
+    std::cout << name << " lookup_batch: " << out.size() << " contracts" << (ok ? ", ok" : ", FAILED") << '\n';
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    std::cout.precision(16);
+    bool passed = true;
+
+    const VolSurface linear = make_surface(VolInterpolation::LinearVariance);
+    const VolSurface spline = make_surface(VolInterpolation::CubicSpline);
+    passed &= check_nodes(linear, "linear");
+    passed &= check_nodes(spline, "spline");
+
+    // Between nodes: chords in total variance across strikes, and always linear across expiries
+    const std::array<double, 3> short_w = row_variance(0);
+    const std::array<double, 3> long_w = row_variance(1);
+    bool linear_ok = check("  K 90, T 0.5", linear.volatility(90.0, 0.5), std::sqrt(0.5 * (short_w[0] + short_w[1]) / 0.5), 1e-15);
+    linear_ok &= check("  K 100, T 0.75", linear.volatility(100.0, 0.75), std::sqrt(0.5 * (short_w[1] + long_w[1]) / 0.75), 1e-15);
+    linear_ok &= check("  K 110, T 0.875", linear.volatility(110.0, 0.875),
+                       std::sqrt((0.25 * 0.5 * (short_w[1] + short_w[2]) + 0.75 * 0.5 * (long_w[1] + long_w[2])) / 0.875), 1e-15);
+    std::cout << "linear between nodes: " << (linear_ok ? "ok" : "FAILED") << '\n';
+    passed &= linear_ok;
+
+    bool spline_ok = check("  K 90, T 1", spline.volatility(90.0, 1.0), std::sqrt(spline_midpoint(long_w, 0)), 1e-15);
+    spline_ok &= check("  K 110, T 0.5", spline.volatility(110.0, 0.5), std::sqrt(spline_midpoint(short_w, 1) / 0.5), 1e-15);
+    spline_ok &= check("  K 90, T 0.75", spline.volatility(90.0, 0.75),
+                       std::sqrt(0.5 * (spline_midpoint(short_w, 0) + spline_midpoint(long_w, 0)) / 0.75), 1e-15);
+    // The spline bends away from the chord on this convex smile
+    spline_ok &= spline.volatility(90.0, 1.0) < linear.volatility(90.0, 1.0);
+    std::cout << "spline between nodes: " << (spline_ok ? "ok" : "FAILED") << '\n';
+    passed &= spline_ok;
+
+    passed &= check_flat_extrapolation(linear, "linear");
+    passed &= check_flat_extrapolation(spline, "spline");
+    passed &= check_batch(linear, "linear");
+    passed &= check_batch(spline, "spline");
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}